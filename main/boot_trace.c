@@ -0,0 +1,74 @@
+/**
+ * Boot Phase Timestamps
+ *
+ * Phases are marked from several tasks and ISRs; each slot is written once
+ * (0 means not reached), so no locking is needed.
+ */
+
+#include "boot_trace.h"
+#include <stdint.h>
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "boot";
+
+static const char *const s_phase_names[BOOT_PHASE_COUNT] = {
+    [BOOT_APP_START]         = "app start",
+    [BOOT_BUS_READY]         = "bus ready",
+    [BOOT_PANEL_RESET]       = "panel reset",
+    [BOOT_PANEL_INIT_CMDS]   = "panel init cmds",
+    [BOOT_PANEL_SLEEP_OUT]   = "panel sleep out",
+    [BOOT_PANEL_SPLASH]      = "panel splash",
+    [BOOT_LVGL_READY]        = "lvgl ready",
+    [BOOT_UI_BUILT]          = "ui built",
+    [BOOT_FIRST_RENDER]      = "first render",
+    [BOOT_PANEL_FIRST_FRAME] = "panel first frame",
+    [BOOT_PANEL_READY]       = "panel ready",
+    [BOOT_FIRST_FRAME_DONE]  = "first frame done",
+    [BOOT_BACKLIGHT_ON]      = "backlight on",
+};
+
+static volatile int64_t s_mark_us[BOOT_PHASE_COUNT];
+
+void IRAM_ATTR boot_trace_mark(boot_phase_t phase)
+{
+    if (phase < BOOT_PHASE_COUNT && s_mark_us[phase] == 0) {
+        s_mark_us[phase] = esp_timer_get_time();
+    }
+}
+
+bool boot_trace_marked(boot_phase_t phase)
+{
+    return phase < BOOT_PHASE_COUNT && s_mark_us[phase] != 0;
+}
+
+void boot_trace_dump(void)
+{
+    // Phases from different tasks interleave: print in time order
+    bool shown[BOOT_PHASE_COUNT] = {0};
+    int64_t prev_us = 0;
+    for (int n = 0; n < BOOT_PHASE_COUNT; n++) {
+        int next = -1;
+        for (int p = 0; p < BOOT_PHASE_COUNT; p++) {
+            if (!shown[p] && s_mark_us[p] &&
+                (next < 0 || s_mark_us[p] < s_mark_us[next])) {
+                next = p;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+        shown[next] = true;
+        int64_t t_us = s_mark_us[next];
+        ESP_LOGI(TAG, "%8lld us (+%7lld) %s", t_us, prev_us ? t_us - prev_us : 0,
+                 s_phase_names[next]);
+        prev_us = t_us;
+    }
+    if (s_mark_us[BOOT_BACKLIGHT_ON]) {
+        // esp_timer counts from early startup, so this excludes the ROM and
+        // second-stage bootloader
+        ESP_LOGI(TAG, "first pixels on glass %lld ms after boot",
+                 s_mark_us[BOOT_BACKLIGHT_ON] / 1000);
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * Boot Phase Timestamps
+ *
+ * Records when each startup milestone is reached (esp_timer time since
+ * boot) so the overlap between panel bring-up and UI construction can be
+ * checked on the log, and the time to a lit, drawn screen measured.
+ */
+
+#ifndef BOOT_TRACE_H
+#define BOOT_TRACE_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Startup milestones
+ */
+typedef enum {
+    BOOT_APP_START = 0,         /*!< app_main entered */
+    BOOT_BUS_READY,             /*!< QSPI bus initialized */
+    BOOT_PANEL_RESET,           /*!< Panel reset pulse started */
+    BOOT_PANEL_INIT_CMDS,       /*!< Panel init sequence started */
+    BOOT_PANEL_SLEEP_OUT,       /*!< SLPOUT sent, panel waking */
+    BOOT_PANEL_SPLASH,          /*!< Splash image in GRAM */
+    BOOT_LVGL_READY,            /*!< LVGL initialized and display registered */
+    BOOT_UI_BUILT,              /*!< Screens created */
+    BOOT_FIRST_RENDER,          /*!< First frame rendered by LVGL */
+    BOOT_PANEL_FIRST_FRAME,     /*!< Early frame pushed to GRAM before DISPON */
+    BOOT_PANEL_READY,           /*!< DISPON sent */
+    BOOT_FIRST_FRAME_DONE,      /*!< First frame's last tile completed */
+    BOOT_BACKLIGHT_ON,          /*!< Backlight switched on */
+    BOOT_PHASE_COUNT,
+} boot_phase_t;
+
+/**
+ * @brief Record the time a phase was reached; later marks are ignored
+ *
+ * ISR-safe.
+ */
+void boot_trace_mark(boot_phase_t phase);
+
+/**
+ * @brief Whether a phase has been reached
+ */
+bool boot_trace_marked(boot_phase_t phase);
+
+/**
+ * @brief Log the reached phases in time order with the gap to the previous one
+ *
+ * Ends with the time to first pixels on the glass (backlight on).
+ */
+void boot_trace_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_TRACE_H */
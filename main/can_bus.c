@@ -0,0 +1,386 @@
+/**
+ * CAN Bus Receive Path and Health
+ *
+ * Queue sizing: every subscribed ID is broadcast once per ECU cycle, so a
+ * burst is at most about num_ids frames, and the queue starts at twice
+ * that. The task records the driver queue depth at each wakeup, which is
+ * the burst that built up while it was not running. When that reaches 3/4
+ * of the queue, or the queue overflowed, the queue is doubled: the task
+ * drains the queue, then stops, reinstalls and restarts the driver.
+ * Frames on the wire during the few hundred microseconds that takes are
+ * missed, which is why the queue only ever grows.
+ *
+ * The ESP32 TWAI has no hardware receive timestamps, so frames are stamped
+ * when drained; frames of one burst differ by the drain time only.
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "driver/twai.h"
+#include "can_filter.h"
+#include "can_capture.h"
+#include "can_bus.h"
+
+static const char *TAG = "can";
+
+#define CAN_BUS_TASK_STACK      3072
+#define CAN_BUS_TASK_PRIORITY   (configMAX_PRIORITIES - 2)
+
+// Wake at least this often to refresh error counters when the bus is quiet
+#define CAN_BUS_POLL_MS         100
+// Retry interval while no driver is installed (a resize failed)
+#define CAN_BUS_REINSTALL_MS    1000
+
+#define CAN_BITRATE             1000000     // TWAI_TIMING_CONFIG_1MBITS()
+#define CAN_TX_QUEUE_LEN        5
+#define CAN_RX_QUEUE_MIN        16
+#define CAN_RX_QUEUE_MAX        256
+
+// Unwanted IDs the filter passes, listed at debug level
+#define CAN_FILTER_LOG_FP       16
+
+#define CAN_ALERTS  (TWAI_ALERT_RX_DATA | TWAI_ALERT_RX_QUEUE_FULL | TWAI_ALERT_RX_FIFO_OVERRUN | \
+                     TWAI_ALERT_ERR_PASS | TWAI_ALERT_ERR_ACTIVE | TWAI_ALERT_ABOVE_ERR_WARN | \
+                     TWAI_ALERT_BUS_OFF | TWAI_ALERT_BUS_RECOVERED)
+
+static struct {
+    can_bus_config_t cfg;
+    twai_filter_config_t filter;
+    can_bus_stats_t stats;
+    uint32_t *id_counts;
+    uint32_t *report_counts;
+    can_bus_stats_t report_stats;
+    int64_t report_us;
+    twai_state_t state;
+    bool installed;
+    // Driver counters restart at every install; totals carry over here
+    uint32_t missed_base;
+    uint32_t overrun_base;
+    uint32_t bus_error_base;
+} s_bus;
+
+// Hardware filter for the subscribed IDs, so other ECUs' traffic never
+// costs an interrupt
+static void filter_setup(void)
+{
+    s_bus.filter = (twai_filter_config_t)TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    can_filter_t filter;
+    if (s_bus.cfg.accept_all ||
+        !can_filter_synthesize(s_bus.cfg.ids, s_bus.cfg.num_ids, &filter)) {
+        ESP_LOGI(TAG, "Filter: accept all");
+        return;
+    }
+    s_bus.filter.acceptance_code = filter.acceptance_code;
+    s_bus.filter.acceptance_mask = filter.acceptance_mask;
+    s_bus.filter.single_filter = !filter.dual;
+    ESP_LOGI(TAG, "Filter: %s, code 0x%08" PRIx32 " mask 0x%08" PRIx32 ", passes %" PRIu64
+             " IDs for %u subscribed (%" PRIu64 " unwanted)", filter.dual ? "dual" : "single",
+             filter.acceptance_code, filter.acceptance_mask, filter.pass_count,
+             (unsigned)s_bus.cfg.num_ids, filter.false_positives);
+
+    uint32_t fp[CAN_FILTER_LOG_FP];
+    size_t nfp = can_filter_false_positives(&filter, s_bus.cfg.ids, s_bus.cfg.num_ids, fp,
+                                            CAN_FILTER_LOG_FP);
+    for (size_t i = 0; i < nfp; i++) {
+        ESP_LOGD(TAG, "  unwanted 0x%08" PRIx32, fp[i]);
+    }
+}
+
+static esp_err_t driver_install(uint32_t rx_queue_len)
+{
+    const twai_general_config_t g_config = {
+        .mode           = TWAI_MODE_NORMAL,
+        .tx_io          = s_bus.cfg.tx_gpio,
+        .rx_io          = s_bus.cfg.rx_gpio,
+        .clkout_io      = TWAI_IO_UNUSED,
+        .bus_off_io     = TWAI_IO_UNUSED,
+        .tx_queue_len   = CAN_TX_QUEUE_LEN,
+        .rx_queue_len   = rx_queue_len,
+        .alerts_enabled = CAN_ALERTS,
+        .clkout_divider = 0,
+        .intr_flags     = ESP_INTR_FLAG_LEVEL1,
+    };
+    const twai_timing_config_t t_config = TWAI_TIMING_CONFIG_1MBITS();
+
+    esp_err_t ret = twai_driver_install(&g_config, &t_config, &s_bus.filter);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "TWAI install failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ret = twai_start();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "TWAI start failed: %s", esp_err_to_name(ret));
+        twai_driver_uninstall();
+        return ret;
+    }
+    s_bus.stats.rx_queue_len = rx_queue_len;
+    s_bus.state = TWAI_STATE_RUNNING;
+    s_bus.installed = true;
+    return ESP_OK;
+}
+
+// Subscribed ID's index, or -1 (binary search over the sorted IDs)
+static int id_index(uint32_t id)
+{
+    size_t lo = 0, hi = s_bus.cfg.num_ids;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (s_bus.cfg.ids[mid] < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (lo < s_bus.cfg.num_ids && s_bus.cfg.ids[lo] == id) ? (int)lo : -1;
+}
+
+// Move everything the driver queued into the ring
+static void drain(void)
+{
+    twai_message_t msg;
+    while (twai_receive(&msg, 0) == ESP_OK) {
+        can_frame_t frame = {
+            .id    = msg.identifier,
+            .extd  = msg.extd,
+            .dlc   = msg.data_length_code,
+            .rx_us = esp_timer_get_time(),
+        };
+        memcpy(frame.data, msg.data, sizeof(frame.data));
+        can_ring_push(s_bus.cfg.ring, &frame);
+        can_capture_record(&frame);
+
+        s_bus.stats.frames++;
+        int idx = msg.extd ? id_index(msg.identifier) : -1;
+        if (idx >= 0) {
+            s_bus.id_counts[idx]++;
+        } else {
+            s_bus.stats.other_frames++;
+        }
+    }
+}
+
+// Status counters: error counters and driver loss counts since install
+static void refresh_status(twai_status_info_t *st)
+{
+    if (twai_get_status_info(st) != ESP_OK) {
+        return;
+    }
+    s_bus.state = st->state;
+    s_bus.stats.rec = st->rx_error_counter;
+    s_bus.stats.tec = st->tx_error_counter;
+    s_bus.stats.rx_queue_full = s_bus.missed_base + st->rx_missed_count;
+    s_bus.stats.fifo_overruns = s_bus.overrun_base + st->rx_overrun_count;
+    s_bus.stats.bus_errors = s_bus.bus_error_base + st->bus_error_count;
+    s_bus.stats.ring_overflows = __atomic_load_n(&s_bus.cfg.ring->overflows, __ATOMIC_RELAXED);
+}
+
+static void grow_queue(void)
+{
+    uint32_t len = s_bus.stats.rx_queue_len * 2;
+    if (len > CAN_RX_QUEUE_MAX) {
+        return;
+    }
+    twai_status_info_t st;
+    drain();
+    twai_stop();
+    refresh_status(&st);
+    s_bus.missed_base = s_bus.stats.rx_queue_full;
+    s_bus.overrun_base = s_bus.stats.fifo_overruns;
+    s_bus.bus_error_base = s_bus.stats.bus_errors;
+    twai_driver_uninstall();
+    s_bus.installed = false;
+    if (driver_install(len) != ESP_OK) {
+        // Fall back to the size that worked
+        if (driver_install(len / 2) != ESP_OK) {
+            s_bus.state = TWAI_STATE_STOPPED;
+            ESP_LOGE(TAG, "No TWAI driver after a failed RX queue resize; retrying every %d ms",
+                     CAN_BUS_REINSTALL_MS);
+        }
+        return;
+    }
+    s_bus.stats.rx_queue_resizes++;
+    ESP_LOGW(TAG, "RX queue -> %" PRIu32 " frames (burst depth %" PRIu32 ")", len,
+             s_bus.stats.rx_queue_high_water);
+}
+
+static void can_bus_task(void *arg)
+{
+    twai_status_info_t st = {0};
+    while (1) {
+        if (!s_bus.installed) {
+            // twai_read_alerts() would fail at once and spin this task
+            vTaskDelay(pdMS_TO_TICKS(CAN_BUS_REINSTALL_MS));
+            if (driver_install(s_bus.stats.rx_queue_len) == ESP_OK) {
+                ESP_LOGI(TAG, "TWAI driver reinstalled, RX queue %" PRIu32, s_bus.stats.rx_queue_len);
+            }
+            continue;
+        }
+        uint32_t alerts = 0;
+        twai_read_alerts(&alerts, pdMS_TO_TICKS(CAN_BUS_POLL_MS));
+
+        // Queue depth before draining: the burst since the last wakeup
+        refresh_status(&st);
+        if (alerts & TWAI_ALERT_RX_DATA) {
+            s_bus.stats.wakeups++;
+            if (st.msgs_to_rx > s_bus.stats.rx_queue_high_water) {
+                s_bus.stats.rx_queue_high_water = st.msgs_to_rx;
+            }
+        }
+        drain();
+
+        if (alerts & TWAI_ALERT_RX_FIFO_OVERRUN) {
+            ESP_LOGW(TAG, "Controller FIFO overrun");
+        }
+        if (alerts & TWAI_ALERT_ABOVE_ERR_WARN) {
+            ESP_LOGW(TAG, "Error counters above warning limit (REC %" PRIu32 ", TEC %" PRIu32 ")",
+                     s_bus.stats.rec, s_bus.stats.tec);
+        }
+        if (alerts & TWAI_ALERT_ERR_PASS) {
+            s_bus.stats.err_passive++;
+            ESP_LOGW(TAG, "Error passive");
+        }
+        if (alerts & TWAI_ALERT_ERR_ACTIVE) {
+            ESP_LOGI(TAG, "Error active");
+        }
+        if (alerts & TWAI_ALERT_BUS_OFF) {
+            s_bus.stats.bus_off++;
+            ESP_LOGE(TAG, "Bus-off, recovering");
+            twai_initiate_recovery();
+        }
+        if (alerts & TWAI_ALERT_BUS_RECOVERED) {
+            s_bus.stats.recoveries++;
+            ESP_LOGI(TAG, "Bus recovered");
+            twai_start();
+        }
+
+        if (s_bus.state == TWAI_STATE_RUNNING &&
+            ((alerts & TWAI_ALERT_RX_QUEUE_FULL) ||
+             s_bus.stats.rx_queue_high_water * 4 >= s_bus.stats.rx_queue_len * 3)) {
+            grow_queue();
+        }
+    }
+}
+
+esp_err_t can_bus_start(const can_bus_config_t *config)
+{
+    if (!config || !config->ring || (config->num_ids && !config->ids)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_bus.cfg = *config;
+    size_t n = config->num_ids ? config->num_ids : 1;
+    s_bus.id_counts = heap_caps_calloc(n, sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    s_bus.report_counts = heap_caps_calloc(n, sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    if (!s_bus.id_counts || !s_bus.report_counts) {
+        heap_caps_free(s_bus.id_counts);
+        heap_caps_free(s_bus.report_counts);
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t len = CAN_RX_QUEUE_MIN;
+    while (len < config->num_ids * 2 && len < CAN_RX_QUEUE_MAX) {
+        len *= 2;
+    }
+    filter_setup();
+    if (config->capture_bytes) {
+        esp_err_t ret = can_capture_start(config->capture_bytes, CAN_BITRATE);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Capture start failed: %s", esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    esp_err_t ret = driver_install(len);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    s_bus.report_us = esp_timer_get_time();
+
+    // Same core as the driver's interrupt, which was allocated here
+    if (xTaskCreatePinnedToCore(can_bus_task, "can_bus", CAN_BUS_TASK_STACK, NULL,
+                                CAN_BUS_TASK_PRIORITY, NULL, xPortGetCoreID()) != pdPASS) {
+        twai_stop();
+        twai_driver_uninstall();
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "1 Mbit/s, %u subscribed IDs, RX queue %" PRIu32, (unsigned)config->num_ids, len);
+    return ESP_OK;
+}
+
+void can_bus_get_stats(can_bus_stats_t *out)
+{
+    *out = s_bus.stats;
+}
+
+size_t can_bus_get_id_counts(const uint32_t **counts)
+{
+    *counts = s_bus.id_counts;
+    return s_bus.cfg.num_ids;
+}
+
+static const char *state_name(twai_state_t state)
+{
+    switch (state) {
+    case TWAI_STATE_RUNNING:    return "running";
+    case TWAI_STATE_BUS_OFF:    return "bus-off";
+    case TWAI_STATE_RECOVERING: return "recovering";
+    default:                    return "stopped";
+    }
+}
+
+void can_bus_report(void)
+{
+    int64_t now_us = esp_timer_get_time();
+    int64_t window_us = now_us - s_bus.report_us;
+    if (!s_bus.id_counts || window_us <= 0) {
+        return;
+    }
+    can_bus_stats_t s = s_bus.stats;
+    can_bus_stats_t *r = &s_bus.report_stats;
+
+    int64_t fps = ((int64_t)(s.frames - r->frames) * 1000000) / window_us;
+    ESP_LOGI(TAG, "bus    | %s, REC %" PRIu32 " TEC %" PRIu32 " | %lld frames/s, %" PRIu32
+             " unsubscribed | RX queue %" PRIu32 ", burst depth %" PRIu32 ", %" PRIu32 " resizes",
+             state_name(s_bus.state), s.rec, s.tec, fps, s.other_frames - r->other_frames,
+             s.rx_queue_len, s.rx_queue_high_water, s.rx_queue_resizes);
+
+    uint32_t lost = s.rx_queue_full + s.fifo_overruns + s.ring_overflows;
+    if (lost == 0) {
+        ESP_LOGI(TAG, "loss   | lossless (%" PRIu32 " frames)", s.frames);
+    } else {
+        ESP_LOGW(TAG, "loss   | queue full %" PRIu32 ", FIFO overrun %" PRIu32 ", ring %" PRIu32,
+                 s.rx_queue_full, s.fifo_overruns, s.ring_overflows);
+    }
+    if (s_bus.cfg.capture_bytes) {
+        can_capture_stats_t cap;
+        can_capture_get_stats(&cap);
+        ESP_LOGI(TAG, "capture| %" PRIu32 " frames, %" PRIu32 " dropped, %" PRIu32 " bytes streamed",
+                 cap.records, cap.dropped, cap.bytes);
+    }
+    ESP_LOGI(TAG, "errors | bus %" PRIu32 ", error passive %" PRIu32 ", bus-off %" PRIu32
+             " (%" PRIu32 " recovered)", s.bus_errors - r->bus_errors, s.err_passive,
+             s.bus_off, s.recoveries);
+
+    // Slowest subscribed ID bounds how fresh the gauges can be
+    int slowest = -1;
+    uint32_t slowest_n = UINT32_MAX;
+    for (size_t i = 0; i < s_bus.cfg.num_ids; i++) {
+        uint32_t n = s_bus.id_counts[i] - s_bus.report_counts[i];
+        s_bus.report_counts[i] = s_bus.id_counts[i];
+        ESP_LOGD(TAG, "  0x%08" PRIx32 " %lld Hz", s_bus.cfg.ids[i],
+                 ((int64_t)n * 1000000) / window_us);
+        if (n < slowest_n) {
+            slowest_n = n;
+            slowest = (int)i;
+        }
+    }
+    if (slowest >= 0) {
+        ESP_LOGI(TAG, "rates  | slowest 0x%08" PRIx32 " at %lld Hz", s_bus.cfg.ids[slowest],
+                 ((int64_t)slowest_n * 1000000) / window_us);
+    }
+    *r = s;
+    s_bus.report_us = now_us;
+}
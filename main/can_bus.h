@@ -0,0 +1,94 @@
+/**
+ * CAN Bus Receive Path and Health
+ *
+ * Owns the TWAI driver. One task, started on the calling core, sleeps on
+ * TWAI alerts: a data alert wakes it to move every queued frame,
+ * timestamped, into the decoder's ring. Error alerts are counted, and
+ * bus-off is recovered. Because it is the only task touching the driver,
+ * it can also reinstall the driver with a deeper receive queue when the
+ * measured burst depth gets close to the current one.
+ *
+ * Loss is visible at each stage:
+ *   controller  RX FIFO overrun (64-byte hardware FIFO)
+ *   driver      receive queue full
+ *   ring        decoder too slow (can_ring_t::overflows)
+ * The report states "lossless" only while all three are zero.
+ */
+
+#ifndef CAN_BUS_H
+#define CAN_BUS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "can_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Receive path configuration
+ */
+typedef struct {
+    gpio_num_t tx_gpio;         /*!< To the transceiver's TXD */
+    gpio_num_t rx_gpio;         /*!< From the transceiver's RXD */
+    const uint32_t *ids;        /*!< Subscribed 29-bit IDs, sorted, unique */
+    size_t num_ids;
+    bool accept_all;            /*!< Skip the acceptance filter (whole-bus capture) */
+    can_ring_t *ring;           /*!< Where received frames go */
+    size_t capture_bytes;       /*!< Also stream frames to the console (can_capture.h), 0 = off */
+} can_bus_config_t;
+
+/**
+ * @brief Receive path counters (cumulative)
+ */
+typedef struct {
+    uint32_t frames;            /*!< Frames received */
+    uint32_t other_frames;      /*!< Of those, IDs not subscribed (filter false positives) */
+    uint32_t wakeups;           /*!< Data alerts handled (one per burst) */
+    uint32_t rx_queue_len;      /*!< Current driver receive queue length */
+    uint32_t rx_queue_high_water;   /*!< Deepest driver queue seen at a wakeup */
+    uint32_t rx_queue_resizes;  /*!< Driver reinstalls with a deeper queue */
+    uint32_t rx_queue_full;     /*!< Frames dropped on a full driver queue */
+    uint32_t fifo_overruns;     /*!< Frames lost to controller FIFO overruns */
+    uint32_t ring_overflows;    /*!< Frames dropped on a full ring */
+    uint32_t bus_errors;        /*!< Bus errors (bit, stuff, form, ACK, CRC) */
+    uint32_t err_passive;       /*!< Transitions to error passive */
+    uint32_t bus_off;           /*!< Transitions to bus-off */
+    uint32_t recoveries;        /*!< Completed bus-off recoveries */
+    uint32_t rec;               /*!< Receive error counter (current) */
+    uint32_t tec;               /*!< Transmit error counter (current) */
+} can_bus_stats_t;
+
+/**
+ * @brief Install the TWAI driver and start the receive task on this core
+ *
+ * The driver's interrupt and the task stay on the calling core.
+ */
+esp_err_t can_bus_start(const can_bus_config_t *config);
+
+/**
+ * @brief Read the counters (any task)
+ */
+void can_bus_get_stats(can_bus_stats_t *out);
+
+/**
+ * @brief Frames received per subscribed ID (config order), cumulative
+ *
+ * @return Number of entries (num_ids)
+ */
+size_t can_bus_get_id_counts(const uint32_t **counts);
+
+/**
+ * @brief Log bus state, loss counters and per-ID frame rates since the last report
+ */
+void can_bus_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAN_BUS_H */
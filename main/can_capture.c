@@ -0,0 +1,279 @@
+/**
+ * CAN Capture Format and Recorder
+ *
+ * The recorder's byte ring has free-running head/tail counters like
+ * can_ring_t: the receive task writes whole records and publishes head,
+ * the streamer prints up to head and publishes tail. Line breaks fall
+ * anywhere; concatenating the hex gives back the byte stream.
+ */
+
+#include "can_capture.h"
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include <stdio.h>
+#include <sys/time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#endif
+
+#define FLAG_DLC_MASK       0x0Fu
+#define FLAG_EXTD           0x10u
+#define FLAG_RESERVED       0xE0u
+#define CAN_STD_ID_MASK     0x7FFu
+#define VARINT_MAX          10
+
+static void put_le(uint8_t *p, uint64_t v, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+static uint64_t get_le(const uint8_t *p, int bytes)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < bytes; i++) {
+        v |= (uint64_t)p[i] << (8 * i);
+    }
+    return v;
+}
+
+void can_capture_write_header(const can_capture_header_t *header, uint8_t *buf)
+{
+    memset(buf, 0, CAN_CAPTURE_HEADER_SIZE);
+    memcpy(buf, CAN_CAPTURE_MAGIC, 4);
+    put_le(buf + 4, CAN_CAPTURE_VERSION, 2);
+    put_le(buf + 6, CAN_CAPTURE_HEADER_SIZE, 2);
+    put_le(buf + 8, header->start_unix_us, 8);
+    put_le(buf + 16, (uint64_t)header->start_us, 8);
+    put_le(buf + 24, header->bitrate, 4);
+}
+
+bool can_capture_read_header(const uint8_t *buf, size_t len, can_capture_header_t *out)
+{
+    if (len < CAN_CAPTURE_HEADER_SIZE || memcmp(buf, CAN_CAPTURE_MAGIC, 4) != 0) {
+        return false;
+    }
+    out->version = (uint16_t)get_le(buf + 4, 2);
+    // Later versions may grow the header, but not change these fields
+    if (out->version != CAN_CAPTURE_VERSION ||
+        get_le(buf + 6, 2) != CAN_CAPTURE_HEADER_SIZE) {
+        return false;
+    }
+    out->start_unix_us = get_le(buf + 8, 8);
+    out->start_us = (int64_t)get_le(buf + 16, 8);
+    out->bitrate = (uint32_t)get_le(buf + 24, 4);
+    return true;
+}
+
+size_t can_capture_encode(const can_frame_t *frame, int64_t *prev_us, uint8_t *buf)
+{
+    // Out-of-order stamps are recorded as simultaneous, so the decoder's
+    // running time always matches ours
+    uint64_t delta = frame->rx_us > *prev_us ? (uint64_t)(frame->rx_us - *prev_us) : 0;
+    *prev_us += (int64_t)delta;
+
+    size_t n = 0;
+    do {
+        buf[n++] = (uint8_t)((delta & 0x7F) | (delta > 0x7F ? 0x80 : 0));
+        delta >>= 7;
+    } while (delta);
+
+    uint8_t dlc = frame->dlc > 8 ? 8 : frame->dlc;
+    buf[n++] = dlc | (frame->extd ? FLAG_EXTD : 0);
+    if (frame->extd) {
+        put_le(buf + n, frame->id & CAN_EXT_ID_MASK, 4);
+        n += 4;
+    } else {
+        put_le(buf + n, frame->id & CAN_STD_ID_MASK, 2);
+        n += 2;
+    }
+    memcpy(buf + n, frame->data, dlc);
+    return n + dlc;
+}
+
+size_t can_capture_decode(const uint8_t *buf, size_t len, int64_t *prev_us, can_frame_t *out)
+{
+    uint64_t delta = 0;
+    size_t n = 0;
+    for (int shift = 0;; shift += 7) {
+        if (n == len || n == VARINT_MAX) {
+            return 0;
+        }
+        uint8_t b = buf[n++];
+        delta |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+
+    if (n == len) {
+        return 0;
+    }
+    uint8_t flags = buf[n++];
+    uint8_t dlc = flags & FLAG_DLC_MASK;
+    if ((flags & FLAG_RESERVED) || dlc > 8) {
+        return 0;
+    }
+    bool extd = flags & FLAG_EXTD;
+    size_t id_bytes = extd ? 4 : 2;
+    if (len - n < id_bytes + dlc) {
+        return 0;
+    }
+    uint32_t id = (uint32_t)get_le(buf + n, (int)id_bytes);
+    if (id & ~(extd ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK)) {
+        return 0;
+    }
+    n += id_bytes;
+
+    *prev_us += (int64_t)delta;
+    memset(out, 0, sizeof(*out));
+    out->id = id;
+    out->extd = extd;
+    out->dlc = dlc;
+    out->rx_us = *prev_us;
+    memcpy(out->data, buf + n, dlc);
+    return n + dlc;
+}
+
+#ifdef ESP_PLATFORM
+
+static const char *TAG = "capture";
+
+#define STREAM_TASK_STACK       3072
+#define STREAM_TASK_PRIORITY    1
+#define STREAM_POLL_MS          20
+#define STREAM_LINE_BYTES       32
+
+// Clock before this is not wall time (no SNTP/RTC): header says unknown
+#define WALL_CLOCK_VALID_S      1577836800      // 2020-01-01
+
+static struct {
+    uint8_t *buf;
+    uint32_t mask;
+    uint32_t head;              // Bytes written (receive task)
+    uint32_t tail;              // Bytes streamed (streamer)
+    int64_t prev_us;            // Receive task only
+    can_capture_stats_t stats;
+} s_cap;
+
+// Producer: copy into the ring, wrapping at the end of the storage
+static void ring_write(const uint8_t *data, uint32_t len)
+{
+    uint32_t head = s_cap.head;
+    uint32_t off = head & s_cap.mask;
+    uint32_t first = s_cap.mask + 1 - off;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(s_cap.buf + off, data, first);
+    memcpy(s_cap.buf, data + first, len - first);
+    __atomic_store_n(&s_cap.head, head + len, __ATOMIC_RELEASE);
+}
+
+static void stream_task(void *arg)
+{
+    static const char hex[] = "0123456789abcdef";
+    char line[4 + STREAM_LINE_BYTES * 2 + 2];
+    memcpy(line, "CAP ", 4);
+
+    while (1) {
+        uint32_t head = __atomic_load_n(&s_cap.head, __ATOMIC_ACQUIRE);
+        uint32_t tail = s_cap.tail;
+        if (head == tail) {
+            vTaskDelay(pdMS_TO_TICKS(STREAM_POLL_MS));
+            continue;
+        }
+        uint32_t n = head - tail;
+        if (n > STREAM_LINE_BYTES) {
+            n = STREAM_LINE_BYTES;
+        }
+        char *p = line + 4;
+        for (uint32_t i = 0; i < n; i++) {
+            uint8_t b = s_cap.buf[(tail + i) & s_cap.mask];
+            *p++ = hex[b >> 4];
+            *p++ = hex[b & 0xF];
+        }
+        *p++ = '\n';
+        *p = '\0';
+        fputs(line, stdout);
+        __atomic_store_n(&s_cap.tail, tail + n, __ATOMIC_RELEASE);
+        __atomic_store_n(&s_cap.stats.bytes, s_cap.stats.bytes + n, __ATOMIC_RELAXED);
+    }
+}
+
+esp_err_t can_capture_start(size_t buffer_bytes, uint32_t bitrate)
+{
+    if (s_cap.buf) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (buffer_bytes < CAN_CAPTURE_HEADER_SIZE || (buffer_bytes & (buffer_bytes - 1))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint8_t *buf = heap_caps_malloc(buffer_bytes, MALLOC_CAP_SPIRAM);
+    if (!buf) {
+        buf = heap_caps_malloc(buffer_bytes, MALLOC_CAP_INTERNAL);
+    }
+    if (!buf) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    can_capture_header_t header = {
+        .version = CAN_CAPTURE_VERSION,
+        .start_unix_us = tv.tv_sec >= WALL_CLOCK_VALID_S ?
+                         (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec : 0,
+        .start_us = esp_timer_get_time(),
+        .bitrate = bitrate,
+    };
+    uint8_t hdr[CAN_CAPTURE_HEADER_SIZE];
+    can_capture_write_header(&header, hdr);
+
+    s_cap.mask = buffer_bytes - 1;
+    s_cap.prev_us = header.start_us;
+    s_cap.buf = buf;
+    ring_write(hdr, sizeof(hdr));
+
+    if (xTaskCreate(stream_task, "can_capture", STREAM_TASK_STACK, NULL,
+                    STREAM_TASK_PRIORITY, NULL) != pdPASS) {
+        s_cap.buf = NULL;
+        heap_caps_free(buf);
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Streaming CAN capture to the console, %u-byte buffer", (unsigned)buffer_bytes);
+    return ESP_OK;
+}
+
+void can_capture_record(const can_frame_t *frame)
+{
+    if (!s_cap.buf) {
+        return;
+    }
+    uint8_t rec[CAN_CAPTURE_RECORD_MAX];
+    int64_t prev_us = s_cap.prev_us;
+    size_t len = can_capture_encode(frame, &prev_us, rec);
+
+    uint32_t tail = __atomic_load_n(&s_cap.tail, __ATOMIC_ACQUIRE);
+    if (s_cap.head - tail + len > s_cap.mask + 1) {
+        // Keep the running time: the next record's delta covers this one
+        __atomic_store_n(&s_cap.stats.dropped, s_cap.stats.dropped + 1, __ATOMIC_RELAXED);
+        return;
+    }
+    s_cap.prev_us = prev_us;
+    ring_write(rec, (uint32_t)len);
+    __atomic_store_n(&s_cap.stats.records, s_cap.stats.records + 1, __ATOMIC_RELAXED);
+}
+
+void can_capture_get_stats(can_capture_stats_t *out)
+{
+    out->records = __atomic_load_n(&s_cap.stats.records, __ATOMIC_RELAXED);
+    out->dropped = __atomic_load_n(&s_cap.stats.dropped, __ATOMIC_RELAXED);
+    out->bytes = __atomic_load_n(&s_cap.stats.bytes, __ATOMIC_RELAXED);
+}
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * CAN Capture Format and Recorder
+ *
+ * A capture is a header followed by one record per received frame, all
+ * little-endian:
+ *
+ *   header  "HCAP", u16 version, u16 header size, u64 wall-clock start
+ *           (Unix us, 0 if unknown), i64 receive-clock start (us), u32
+ *           bitrate, u32 reserved                                 32 bytes
+ *   record  LEB128 microseconds since the previous record (the first:
+ *           since the receive-clock start), u8 flags (bits 3-0 DLC, bit
+ *           4 extended), ID (u32 extended, u16 standard), DLC bytes
+ *
+ * A 4-byte Holley frame up to 16 ms after the previous one takes 11 bytes
+ * against 24 for a can_frame_t, and timestamps lose nothing.
+ *
+ * The codec is plain C so tools/can_replay.c reads captures off-target.
+ * The recorder (ESP-IDF only) streams records from the CAN receive task to
+ * the console as "CAP <hex>" lines through a byte ring; a record that
+ * doesn't fit is dropped whole and counted, so the stream always decodes.
+ */
+
+#ifndef CAN_CAPTURE_H
+#define CAN_CAPTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "holley_can.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CAN_CAPTURE_MAGIC           "HCAP"
+#define CAN_CAPTURE_VERSION         1
+#define CAN_CAPTURE_HEADER_SIZE     32
+/** Longest record: 10-byte delta, flags, 4-byte ID, 8 data bytes */
+#define CAN_CAPTURE_RECORD_MAX      23
+
+/**
+ * @brief Capture header
+ */
+typedef struct {
+    uint16_t version;
+    uint64_t start_unix_us;     /*!< Wall-clock time at start_us, 0 if unknown */
+    int64_t start_us;           /*!< Receive clock (can_frame_t::rx_us) at the start */
+    uint32_t bitrate;           /*!< Bus bitrate, bit/s */
+} can_capture_header_t;
+
+/**
+ * @brief Encode the header
+ *
+ * @param[out] buf CAN_CAPTURE_HEADER_SIZE bytes
+ */
+void can_capture_write_header(const can_capture_header_t *header, uint8_t *buf);
+
+/**
+ * @brief Decode and check the header
+ *
+ * @return false if buf is not a capture of a supported version
+ */
+bool can_capture_read_header(const uint8_t *buf, size_t len, can_capture_header_t *out);
+
+/**
+ * @brief Encode one frame
+ *
+ * @param prev_us Receive time of the previous record (start_us for the first); updated
+ * @param[out] buf At least CAN_CAPTURE_RECORD_MAX bytes
+ * @return Record size in bytes
+ */
+size_t can_capture_encode(const can_frame_t *frame, int64_t *prev_us, uint8_t *buf);
+
+/**
+ * @brief Decode one record
+ *
+ * @param prev_us Receive time of the previous record (start_us for the first); updated
+ * @return Bytes consumed, 0 if the record is truncated or malformed
+ */
+size_t can_capture_decode(const uint8_t *buf, size_t len, int64_t *prev_us, can_frame_t *out);
+
+#ifdef ESP_PLATFORM
+/**
+ * @brief Recorder counters
+ */
+typedef struct {
+    uint32_t records;           /*!< Frames recorded */
+    uint32_t dropped;           /*!< Frames dropped on a full buffer */
+    uint32_t bytes;             /*!< Bytes streamed, header included */
+} can_capture_stats_t;
+
+/**
+ * @brief Allocate the buffer (PSRAM when present) and start the console streamer
+ *
+ * The streamer runs at the lowest priority, so the console only carries
+ * the capture while the CPU is otherwise idle.
+ *
+ * @param buffer_bytes Byte ring size, a power of two
+ * @param bitrate Written to the header
+ */
+esp_err_t can_capture_start(size_t buffer_bytes, uint32_t bitrate);
+
+/**
+ * @brief Append a frame (single producer, the CAN receive task); no-op if not started
+ */
+void can_capture_record(const can_frame_t *frame);
+
+/**
+ * @brief Read the counters (any task)
+ */
+void can_capture_get_stats(can_capture_stats_t *out);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAN_CAPTURE_H */
@@ -0,0 +1,227 @@
+/**
+ * TWAI Acceptance Filter Synthesis
+ *
+ * Register layout for extended frames (acceptance_code/mask bit 31 = ACR0
+ * bit 7, mask bit 1 = don't care):
+ *   single  bits 31-3 = ID 28-0, bit 2 = RTR, bits 1-0 unused
+ *   dual    bits 31-16 = filter 1, bits 15-0 = filter 2, each ID 28-13
+ */
+
+#include "can_filter.h"
+
+#define ID_BITS             29
+#define ID_MASK             0x1FFFFFFFu
+#define DUAL_SHIFT          13                      // Dual filters see ID bits 28-13
+#define DUAL_KEY_MASK       0xFFFFu
+#define DUAL_CARE_MASK      (DUAL_KEY_MASK << DUAL_SHIFT)
+#define SINGLE_ID_SHIFT     3
+#define SINGLE_UNUSED_BITS  0x3u
+
+// Largest number of distinct ID 28-13 keys split exhaustively in dual mode
+#define DUAL_EXHAUSTIVE_MAX 16
+
+typedef struct {
+    uint32_t code;
+    uint32_t care;
+} cube_t;
+
+static uint64_t cube_size(cube_t c)
+{
+    return 1ULL << (ID_BITS - __builtin_popcount(c.care & ID_MASK));
+}
+
+static uint64_t union_size(cube_t a, cube_t b)
+{
+    uint64_t both = a.care | b.care;
+    uint64_t overlap = ((a.code ^ b.code) & a.care & b.care) ? 0 :
+                       1ULL << (ID_BITS - __builtin_popcount(both & ID_MASK));
+    return cube_size(a) + cube_size(b) - overlap;
+}
+
+// Tightest cube over IDs whose AND and OR are given, comparing only allowed bits
+static cube_t cube_from(uint32_t all_and, uint32_t all_or, uint32_t allowed)
+{
+    cube_t c;
+    c.care = ~(all_and ^ all_or) & allowed;
+    c.code = all_and & c.care;
+    return c;
+}
+
+static void make_single(const uint32_t *ids, size_t n, can_filter_t *f)
+{
+    uint32_t all_and = ID_MASK, all_or = 0;
+    for (size_t i = 0; i < n; i++) {
+        all_and &= ids[i];
+        all_or |= ids[i];
+    }
+    cube_t c = cube_from(all_and, all_or, ID_MASK);
+    f->dual = false;
+    f->code[0] = f->code[1] = c.code;
+    f->care[0] = f->care[1] = c.care;
+    f->pass_count = cube_size(c);
+    // Data frames only: RTR compared against 0
+    f->acceptance_code = c.code << SINGLE_ID_SHIFT;
+    f->acceptance_mask = ((~c.care & ID_MASK) << SINGLE_ID_SHIFT) | SINGLE_UNUSED_BITS;
+}
+
+// Dual filter candidate: one cube per group of IDs
+typedef struct {
+    cube_t a, b;
+    uint64_t size;
+} split_t;
+
+static split_t split_eval(uint32_t and0, uint32_t or0, uint32_t and1, uint32_t or1)
+{
+    split_t s;
+    s.a = cube_from(and0, or0, DUAL_CARE_MASK);
+    s.b = cube_from(and1, or1, DUAL_CARE_MASK);
+    s.size = union_size(s.a, s.b);
+    return s;
+}
+
+static bool make_dual(const uint32_t *ids, size_t n, can_filter_t *f)
+{
+    // Distinct keys (ID 28-13); a split of the keys is a split of the IDs
+    uint32_t keys[DUAL_EXHAUSTIVE_MAX];
+    size_t nkeys = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t key = ids[i] & DUAL_CARE_MASK;
+        size_t k = 0;
+        while (k < nkeys && keys[k] != key) {
+            k++;
+        }
+        if (k < nkeys) {
+            continue;
+        }
+        if (nkeys == DUAL_EXHAUSTIVE_MAX) {
+            nkeys++;                    // Too many: marks the heuristic below
+            break;
+        }
+        keys[nkeys++] = key;
+    }
+
+    split_t best = { .size = UINT64_MAX };
+    if (nkeys <= DUAL_EXHAUSTIVE_MAX) {
+        // Every split with keys[0] in group 0 (the rest mirror these)
+        for (uint32_t m = 0; m < (1u << (nkeys - 1)); m++) {
+            uint32_t and0 = ID_MASK, or0 = 0, and1 = ID_MASK, or1 = 0;
+            for (size_t k = 0; k < nkeys; k++) {
+                if (k && (m >> (k - 1)) & 1) {
+                    and1 &= keys[k];
+                    or1 |= keys[k];
+                } else {
+                    and0 &= keys[k];
+                    or0 |= keys[k];
+                }
+            }
+            if (!m) {
+                and1 = and0;
+                or1 = or0;
+            }
+            split_t s = split_eval(and0, or0, and1, or1);
+            if (s.size < best.size) {
+                best = s;
+            }
+        }
+    } else {
+        // Too many to try every split: best split on one ID bit
+        for (int bit = DUAL_SHIFT; bit < ID_BITS; bit++) {
+            uint32_t and0 = ID_MASK, or0 = 0, and1 = ID_MASK, or1 = 0;
+            size_t n1 = 0;
+            for (size_t i = 0; i < n; i++) {
+                if ((ids[i] >> bit) & 1) {
+                    and1 &= ids[i];
+                    or1 |= ids[i];
+                    n1++;
+                } else {
+                    and0 &= ids[i];
+                    or0 |= ids[i];
+                }
+            }
+            if (n1 == 0 || n1 == n) {
+                continue;               // All on one side: no split
+            }
+            split_t s = split_eval(and0, or0, and1, or1);
+            if (s.size < best.size) {
+                best = s;
+            }
+        }
+        if (best.size == UINT64_MAX) {
+            return false;
+        }
+    }
+
+    f->dual = true;
+    f->code[0] = best.a.code;
+    f->care[0] = best.a.care;
+    f->code[1] = best.b.code;
+    f->care[1] = best.b.care;
+    f->pass_count = best.size;
+    f->acceptance_code = ((best.a.code >> DUAL_SHIFT) << 16) | (best.b.code >> DUAL_SHIFT);
+    f->acceptance_mask = ((~(best.a.care >> DUAL_SHIFT) & DUAL_KEY_MASK) << 16) |
+                         (~(best.b.care >> DUAL_SHIFT) & DUAL_KEY_MASK);
+    return true;
+}
+
+bool can_filter_synthesize(const uint32_t *ids, size_t n, can_filter_t *out)
+{
+    if (!ids || n == 0) {
+        return false;
+    }
+    make_single(ids, n, out);
+
+    // Dual only compares 16 bits, but two cubes can fit split clusters better
+    can_filter_t dual;
+    if (make_dual(ids, n, &dual) && dual.pass_count < out->pass_count) {
+        *out = dual;
+    }
+    out->false_positives = out->pass_count - n;
+    return true;
+}
+
+bool can_filter_accepts(const can_filter_t *f, uint32_t id)
+{
+    uint32_t code = f->acceptance_code;
+    uint32_t mask = f->acceptance_mask;
+    if (!f->dual) {
+        uint32_t frame = (id & ID_MASK) << SINGLE_ID_SHIFT;     // RTR = 0
+        return ((frame ^ code) & ~mask) == 0;
+    }
+    uint32_t key = (id >> DUAL_SHIFT) & DUAL_KEY_MASK;
+    bool f1 = ((key ^ (code >> 16)) & ~(mask >> 16) & DUAL_KEY_MASK) == 0;
+    bool f2 = ((key ^ code) & ~mask & DUAL_KEY_MASK) == 0;
+    return f1 || f2;
+}
+
+static bool subscribed(const uint32_t *ids, size_t n, uint32_t id)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (ids[i] == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t can_filter_false_positives(const can_filter_t *f, const uint32_t *ids, size_t n,
+                                  uint32_t *out, size_t max)
+{
+    size_t count = 0;
+    int cubes = f->dual ? 2 : 1;
+    for (int c = 0; c < cubes && count < max; c++) {
+        cube_t cube = { f->code[c], f->care[c] };
+        cube_t first = { f->code[0], f->care[0] };
+        uint32_t free_bits = ~cube.care & ID_MASK;
+        uint32_t x = 0;
+        do {
+            // Walk the cube's free bits in ascending order
+            uint32_t id = cube.code | x;
+            bool dup = c == 1 && ((id ^ first.code) & first.care) == 0;
+            if (!dup && !subscribed(ids, n, id)) {
+                out[count++] = id;
+            }
+            x = (x - free_bits) & free_bits;
+        } while (x && count < max);
+    }
+    return count;
+}
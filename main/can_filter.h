@@ -0,0 +1,78 @@
+/**
+ * TWAI Acceptance Filter Synthesis
+ *
+ * Works out the hardware acceptance filter that passes a set of 29-bit
+ * IDs and as few others as possible, so unrelated traffic on the bus never
+ * reaches the CPU. The ESP32 TWAI controller (SJA1000 compatible) offers,
+ * for extended frames:
+ *
+ *   single  one code/mask over all 29 ID bits (and RTR)
+ *   dual    two code/masks, each over ID bits 28-13 only
+ *
+ * A code/mask passes a "cube" of IDs: the compared bits fixed, the rest
+ * free. The tightest single filter compares exactly the bits all IDs
+ * share. The dual filter splits the IDs into two groups, each with its own
+ * cube, and is used when the union of the two passes fewer IDs. Either way
+ * every subscribed ID passes by construction.
+ *
+ * Standard (11-bit) frames are matched against a different register
+ * layout and may still get through; the decoder drops them.
+ *
+ * Plain C so it builds and runs off-target.
+ */
+
+#ifndef CAN_FILTER_H
+#define CAN_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Synthesized filter
+ */
+typedef struct {
+    bool dual;                  /*!< Two filters on ID bits 28-13, else one on all 29 */
+    uint32_t code[2];           /*!< Per cube: values of the compared ID bits */
+    uint32_t care[2];           /*!< Per cube: ID bits compared (both equal in single mode) */
+    uint32_t acceptance_code;   /*!< For twai_filter_config_t */
+    uint32_t acceptance_mask;   /*!< For twai_filter_config_t (1 = don't care) */
+    uint64_t pass_count;        /*!< 29-bit IDs the filter passes */
+    uint64_t false_positives;   /*!< Passed IDs that were not subscribed */
+} can_filter_t;
+
+/**
+ * @brief Compute the filter passing the fewest IDs beyond the given set
+ *
+ * @param ids Subscribed 29-bit IDs, unique
+ * @param n Number of IDs, at least 1
+ * @return false if there are no IDs (nothing to filter for)
+ */
+bool can_filter_synthesize(const uint32_t *ids, size_t n, can_filter_t *out);
+
+/**
+ * @brief Whether the controller passes an extended data frame with this ID
+ *
+ * Evaluates acceptance_code/acceptance_mask as the hardware does, so it
+ * also checks the register encoding.
+ */
+bool can_filter_accepts(const can_filter_t *filter, uint32_t id);
+
+/**
+ * @brief List the IDs the filter passes that were not subscribed
+ *
+ * @param[out] out Up to max false-positive IDs, ascending within each cube
+ * @return Number written (false_positives has the full count)
+ */
+size_t can_filter_false_positives(const can_filter_t *filter, const uint32_t *ids, size_t n,
+                                  uint32_t *out, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAN_FILTER_H */
@@ -0,0 +1,59 @@
+/**
+ * CAN Frame Ring
+ *
+ * The producer publishes a slot with a release store of head after
+ * writing it; the consumer frees slots with a release store of tail after
+ * reading them. Each side loads the other's counter with acquire.
+ */
+
+#include "can_ring.h"
+
+bool can_ring_init(can_ring_t *ring, can_frame_t *slots, uint32_t capacity)
+{
+    if (capacity == 0 || (capacity & (capacity - 1))) {
+        return false;
+    }
+    ring->slots = slots;
+    ring->mask = capacity - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overflows = 0;
+    ring->high_water = 0;
+    return true;
+}
+
+bool can_ring_push(can_ring_t *ring, const can_frame_t *frame)
+{
+    uint32_t head = ring->head;
+    uint32_t fill = head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    if (fill > ring->mask) {
+        __atomic_store_n(&ring->overflows, ring->overflows + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    ring->slots[head & ring->mask] = *frame;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    if (fill + 1 > ring->high_water) {
+        __atomic_store_n(&ring->high_water, fill + 1, __ATOMIC_RELAXED);
+    }
+    return true;
+}
+
+uint32_t can_ring_peek(can_ring_t *ring, const can_frame_t **frames)
+{
+    uint32_t tail = ring->tail;
+    uint32_t avail = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - tail;
+    uint32_t to_end = ring->mask + 1 - (tail & ring->mask);
+    *frames = &ring->slots[tail & ring->mask];
+    return avail < to_end ? avail : to_end;
+}
+
+void can_ring_consume(can_ring_t *ring, uint32_t count)
+{
+    __atomic_store_n(&ring->tail, ring->tail + count, __ATOMIC_RELEASE);
+}
+
+uint32_t can_ring_count(const can_ring_t *ring)
+{
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) -
+           __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
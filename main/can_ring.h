@@ -0,0 +1,77 @@
+/**
+ * CAN Frame Ring
+ *
+ * Lock-free single-producer/single-consumer ring between the TWAI receive
+ * task and the decoder. The producer only writes head, the consumer only
+ * writes tail; both are free-running counters, so the fill level is their
+ * difference and a full ring is told apart from an empty one without a
+ * spare slot. The consumer reads frames in place, a contiguous run at a
+ * time, and releases them in one store.
+ *
+ * Plain C so it builds and runs off-target.
+ */
+
+#ifndef CAN_RING_H
+#define CAN_RING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "holley_can.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Ring state; the counters are readable from any task
+ */
+typedef struct {
+    can_frame_t *slots;
+    uint32_t mask;              /*!< Capacity - 1 (capacity is a power of two) */
+    uint32_t head;              /*!< Frames pushed (producer) */
+    uint32_t tail;              /*!< Frames consumed (consumer) */
+    uint32_t overflows;         /*!< Frames dropped on a full ring (producer) */
+    uint32_t high_water;        /*!< Highest fill level seen (producer) */
+} can_ring_t;
+
+/**
+ * @brief Initialize a ring over caller-provided storage
+ *
+ * @param capacity Number of slots, a power of two
+ * @return false if capacity is not a power of two
+ */
+bool can_ring_init(can_ring_t *ring, can_frame_t *slots, uint32_t capacity);
+
+/**
+ * @brief Append a frame (producer only); a full ring drops it and counts an overflow
+ *
+ * @return false if the frame was dropped
+ */
+bool can_ring_push(can_ring_t *ring, const can_frame_t *frame);
+
+/**
+ * @brief Oldest unconsumed frames, as one contiguous run (consumer only)
+ *
+ * Frames beyond the end of the storage come on the next call, after
+ * can_ring_consume().
+ *
+ * @param[out] frames First frame of the run
+ * @return Number of frames in the run, 0 if the ring is empty
+ */
+uint32_t can_ring_peek(can_ring_t *ring, const can_frame_t **frames);
+
+/**
+ * @brief Release the first count frames returned by can_ring_peek() (consumer only)
+ */
+void can_ring_consume(can_ring_t *ring, uint32_t count);
+
+/**
+ * @brief Frames currently queued
+ */
+uint32_t can_ring_count(const can_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAN_RING_H */
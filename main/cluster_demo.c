@@ -0,0 +1,256 @@
+/**
+ * Five-Gauge Cluster Demo
+ *
+ * Pin Configuration (bus 0 is the single-panel demo's bus):
+ * Bus 0 SCLK/D0..D3 -> GPIO6, GPIO8..GPIO11
+ * Bus 1 SCLK/D0..D3 -> GPIO16, GPIO17, GPIO18, GPIO21, GPIO38 (CLUSTER_NUM_BUSES 2)
+ * CS tach/speed/oil/water/fuel -> GPIO5, GPIO12, GPIO13, GPIO14, GPIO15
+ * RST (shared) -> GPIO7
+ * BL  (shared) -> GPIO4
+ */
+
+#include <stddef.h>
+#include "cluster_demo.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "display_manager.h"
+
+static const char *TAG = "cluster";
+
+#define CLUSTER_H_RES           360
+#define CLUSTER_V_RES           360
+#define CLUSTER_PIXEL_CLK       (20 * 1000 * 1000)
+#define CLUSTER_BUF_LINES       40
+// Shared draw tiles: two displays render or flush at once, instead of a
+// private buffer pair per panel (5 x 2 x 28.8 KB)
+#define CLUSTER_ARENA_TILES     4
+#define CLUSTER_CHUNK_BYTES     (CLUSTER_H_RES * 8 * sizeof(uint16_t))
+#define CLUSTER_MAX_TRANSFER    (CLUSTER_H_RES * 80 * sizeof(uint16_t))
+
+// Panels on one bus, or the three auxiliary gauges moved to a second bus
+#define CLUSTER_NUM_BUSES       1
+#define CLUSTER_AUX_BUS         ((CLUSTER_NUM_BUSES > 1) ? 1 : 0)
+
+// The tachometer gets this many times the bus share of the other gauges
+#define CLUSTER_TACH_WEIGHT     4
+
+#define CLUSTER_PIN_RST         7
+#define CLUSTER_PIN_BL          4
+
+// Gauge sweep step period, and interval of the frame rate report
+#define CLUSTER_SIM_PERIOD_MS   30
+#define CLUSTER_REPORT_MS       5000
+
+static const spi_host_device_t s_hosts[] = { SPI2_HOST, SPI3_HOST };
+
+static const struct {
+    int sclk, d0, d1, d2, d3;
+} s_bus_pins[] = {
+    { 6, 8, 9, 10, 11 },
+    { 16, 17, 18, 21, 38 },
+};
+
+static const display_manager_panel_t s_panels[] = {
+    { .name = "tach",  .cs_gpio = 5,  .bus = 0,               .bus_weight = CLUSTER_TACH_WEIGHT },
+    { .name = "speed", .cs_gpio = 12, .bus = 0,               .bus_weight = 1 },
+    { .name = "oil",   .cs_gpio = 13, .bus = CLUSTER_AUX_BUS, .bus_weight = 1 },
+    { .name = "water", .cs_gpio = 14, .bus = CLUSTER_AUX_BUS, .bus_weight = 1 },
+    { .name = "fuel",  .cs_gpio = 15, .bus = CLUSTER_AUX_BUS, .bus_weight = 1 },
+};
+#define CLUSTER_NUM_PANELS  (sizeof(s_panels) / sizeof(s_panels[0]))
+
+// Scale and live signal of each gauge, in s_panels order
+static const struct {
+    int32_t min, max;
+    gauge_signal_t signal;
+} s_gauge_defs[] = {
+    { 0,   6000, GAUGE_RPM },
+    { 0,   120,  GAUGE_SPEED },
+    { 0,   100,  GAUGE_OIL_PRESSURE },
+    { 100, 260,  GAUGE_COOLANT_TEMP },
+    { 0,   100,  GAUGE_FUEL_LEVEL },
+};
+
+// A gauge whose signal went stale is dimmed rather than left looking live
+#define GAUGE_STALE_OPA     LV_OPA_40
+
+static const display_manager_config_t s_dm_config = {
+    .panels            = s_panels,
+    .num_panels        = CLUSTER_NUM_PANELS,
+    .hosts             = s_hosts,
+    .num_buses         = CLUSTER_NUM_BUSES,
+    .rst_gpio          = CLUSTER_PIN_RST,
+    .h_res             = CLUSTER_H_RES,
+    .v_res             = CLUSTER_V_RES,
+    .buf_lines         = CLUSTER_BUF_LINES,
+    .arena_tiles       = CLUSTER_ARENA_TILES,
+    .pclk_hz           = CLUSTER_PIXEL_CLK,
+    .trans_queue_depth = 4,
+    .chunk_bytes       = CLUSTER_CHUNK_BYTES,
+    .pixel_format      = ST77916_PIXEL_RGB565,
+    .round_clip        = true,
+    .shadow_fb         = true,
+};
+
+static TaskHandle_t s_lvgl_task = NULL;
+static volatile uint32_t s_phase = 0;
+static gauge_snapshot_t *s_live = NULL;
+
+static struct {
+    lv_obj_t *meter;
+    lv_meter_indicator_t *needle;
+} s_gauges[CLUSTER_NUM_PANELS];
+
+// One needle gauge filling the active screen of a display
+static void gauge_create(uint8_t index)
+{
+    lv_obj_t *scr = lv_disp_get_scr_act(display_manager_get_disp(index));
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    lv_obj_t *meter = lv_meter_create(scr);
+    lv_obj_set_size(meter, CLUSTER_H_RES, CLUSTER_V_RES);
+    lv_obj_center(meter);
+    lv_meter_scale_t *scale = lv_meter_add_scale(meter);
+    lv_meter_set_scale_ticks(meter, scale, 41, 2, 10, lv_color_hex(0x808080));
+    lv_meter_set_scale_major_ticks(meter, scale, 8, 4, 20, lv_color_hex(0xffffff), 16);
+    lv_meter_set_scale_range(meter, scale, s_gauge_defs[index].min, s_gauge_defs[index].max,
+                             270, 135);
+    s_gauges[index].meter = meter;
+    s_gauges[index].needle = lv_meter_add_needle_line(meter, scale, 6, lv_color_hex(0xffb046), -12);
+}
+
+// Triangle sweep over the gauge's scale in 200 phase steps, offset per
+// gauge so the needles never move in lockstep
+static int32_t gauge_sim_value(uint32_t phase, uint8_t index)
+{
+    uint32_t p = (phase + index * 40) % 200;
+    int32_t pct = (p < 100) ? p : 200 - p;
+    return s_gauge_defs[index].min + (s_gauge_defs[index].max - s_gauge_defs[index].min) * pct / 100;
+}
+
+// Redraw one gauge from live data: needle, and dimmed while stale
+static void gauge_show_live(const gauge_data_t *data, uint8_t index)
+{
+    gauge_signal_t signal = s_gauge_defs[index].signal;
+    lv_meter_set_indicator_value(s_gauges[index].meter, s_gauges[index].needle,
+                                 (int32_t)gauge_data_value(data, signal));
+    lv_obj_set_style_opa(s_gauges[index].meter,
+                         (data->fresh & GAUGE_BIT(signal)) ? LV_OPA_COVER : GAUGE_STALE_OPA,
+                         LV_PART_MAIN);
+}
+
+// Gauge producer (esp_timer task): advance the sweep and wake the LVGL task
+static void cluster_sim_cb(void *arg)
+{
+    s_phase++;
+    xTaskNotifyGive(s_lvgl_task);
+}
+
+// Single task owns all LVGL calls and renders every display
+static void cluster_lvgl_task(void *arg)
+{
+    for (uint8_t i = 0; i < CLUSTER_NUM_PANELS; i++) {
+        gauge_create(i);
+    }
+    // Render each panel's first frame into its shadow while bring-up runs
+    for (uint8_t i = 0; i < CLUSTER_NUM_PANELS; i++) {
+        lv_refr_now(display_manager_get_disp(i));
+    }
+    if (display_manager_wait_ready(portMAX_DELAY) == ESP_OK) {
+        gpio_set_level(CLUSTER_PIN_BL, 1);
+    }
+
+    uint32_t wait_ms = 0;
+    int64_t report_us = esp_timer_get_time();
+    while (1) {
+        TickType_t ticks = (wait_ms == LV_NO_TIMER_READY)
+                           ? portMAX_DELAY
+                           : (wait_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        if (ulTaskNotifyTake(pdTRUE, ticks)) {
+            if (s_live) {
+                // Only the gauges whose signal changed or went stale
+                gauge_data_t data;
+                uint32_t changed = gauge_snapshot_take(s_live, &data);
+                for (uint8_t i = 0; i < CLUSTER_NUM_PANELS; i++) {
+                    if (changed & GAUGE_BIT(s_gauge_defs[i].signal)) {
+                        gauge_show_live(&data, i);
+                    }
+                }
+            } else {
+                uint32_t phase = s_phase;
+                for (uint8_t i = 0; i < CLUSTER_NUM_PANELS; i++) {
+                    lv_meter_set_indicator_value(s_gauges[i].meter, s_gauges[i].needle,
+                                                 gauge_sim_value(phase, i));
+                }
+            }
+        }
+        wait_ms = lv_timer_handler();
+
+        int64_t now_us = esp_timer_get_time();
+        if (now_us - report_us >= CLUSTER_REPORT_MS * 1000LL) {
+            display_manager_report();
+            report_us = now_us;
+        }
+    }
+}
+
+void cluster_demo_notify(void)
+{
+    if (s_lvgl_task) {
+        xTaskNotifyGive(s_lvgl_task);
+    }
+}
+
+void cluster_demo_start(int lvgl_core, gauge_snapshot_t *live)
+{
+    ESP_LOGI(TAG, "Five-gauge cluster demo, %d panels on %d bus(es)",
+             (int)CLUSTER_NUM_PANELS, CLUSTER_NUM_BUSES);
+
+    gpio_config_t bk_gpio_config = {
+        .mode         = GPIO_MODE_OUTPUT,
+        .pin_bit_mask = 1ULL << CLUSTER_PIN_BL,
+    };
+    ESP_ERROR_CHECK(gpio_config(&bk_gpio_config));
+    gpio_set_level(CLUSTER_PIN_BL, 0);
+
+    for (int b = 0; b < CLUSTER_NUM_BUSES; b++) {
+        spi_bus_config_t bus_config = {
+            .sclk_io_num  = s_bus_pins[b].sclk,
+            .data0_io_num = s_bus_pins[b].d0,
+            .data1_io_num = s_bus_pins[b].d1,
+            .data2_io_num = s_bus_pins[b].d2,
+            .data3_io_num = s_bus_pins[b].d3,
+            .data4_io_num = -1,
+            .data5_io_num = -1,
+            .data6_io_num = -1,
+            .data7_io_num = -1,
+            .max_transfer_sz = CLUSTER_MAX_TRANSFER,
+            .flags = SPICOMMON_BUSFLAG_MASTER,
+            .isr_cpu_id = (lvgl_core == 0) ? ESP_INTR_CPU_AFFINITY_0 : ESP_INTR_CPU_AFFINITY_1,
+        };
+        ESP_ERROR_CHECK(spi_bus_initialize(s_hosts[b], &bus_config, SPI_DMA_CH_AUTO));
+    }
+
+    lv_init();
+    ESP_ERROR_CHECK(display_manager_init(&s_dm_config));
+
+    s_live = live;
+    xTaskCreatePinnedToCore(cluster_lvgl_task, "lvgl_cluster", 8192, NULL, 5, &s_lvgl_task,
+                            lvgl_core);
+    if (live) {
+        return;
+    }
+
+    const esp_timer_create_args_t sim_timer_args = {
+        .callback = cluster_sim_cb,
+        .name     = "cluster_sim",
+    };
+    esp_timer_handle_t sim_timer;
+    ESP_ERROR_CHECK(esp_timer_create(&sim_timer_args, &sim_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(sim_timer, CLUSTER_SIM_PERIOD_MS * 1000));
+}
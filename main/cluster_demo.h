@@ -0,0 +1,38 @@
+/**
+ * Five-Gauge Cluster Demo
+ *
+ * Drives five round panels through the display manager, one needle gauge
+ * each, and logs per-panel and aggregate frame rates. The needles sweep on
+ * their own, or follow a live gauge snapshot.
+ */
+
+#ifndef CLUSTER_DEMO_H
+#define CLUSTER_DEMO_H
+
+#include "gauge_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize the buses, panels and LVGL, and start the demo tasks
+ *
+ * Replaces the single-panel setup in app_main(); call it instead.
+ *
+ * @param lvgl_core Core for the LVGL task and the display bus interrupts
+ * @param live Snapshot to show (the demo takes its changed bits), or NULL for the
+ *             simulated sweep
+ */
+void cluster_demo_start(int lvgl_core, gauge_snapshot_t *live);
+
+/**
+ * @brief Wake the cluster's LVGL task to show new snapshot values (task context)
+ */
+void cluster_demo_notify(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLUSTER_DEMO_H */
@@ -0,0 +1,371 @@
+/**
+ * Multi-Panel Display Manager
+ *
+ * Each panel gets its own esp_lcd panel IO (its CS line) on a shared QSPI
+ * bus, a driver instance and an LVGL display. LVGL renders the displays
+ * one after the other from a single task; since flushes are asynchronous,
+ * one panel's tiles are still on the bus while the next display renders,
+ * and the bus scheduler decides whose tile goes next.
+ *
+ * Draw buffers come from a shared arena: a display leases them in LVGL's
+ * render_start_cb and returns them from the transfer-done ISR of its last
+ * tile. If the next refresh of the same display starts before that tile
+ * is done, the lease simply carries over.
+ */
+
+#include "display_manager.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "display_mgr";
+
+#define DM_BUS_SLOTS_DEFAULT    2
+#define DM_ARENA_TILES_DEFAULT  4
+
+typedef struct {
+    const display_manager_panel_t *desc;
+    esp_lcd_panel_io_handle_t io;
+    st77916_panel_handle_t panel;
+    uint8_t sched_client;
+    lv_disp_drv_t drv;
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_t *disp;
+
+    // Draw-buffer lease, guarded by s_dm.lock
+    void *lease[2];
+    bool rendering;                 // Between render_start_cb and the last flush
+
+    // Frame accounting: a frame is done when its last tile completes
+    uint32_t submitted;             // Tiles handed to the driver
+    uint32_t done;                  // Tiles completed (ISR)
+    uint32_t last_seq;              // Sequence number of the frame's last tile
+    volatile uint32_t frames;       // Frames completed (ISR)
+    uint32_t report_frames;         // frames at the last report
+} dm_display_t;
+
+static struct {
+    const display_manager_config_t *config;
+    st77916_bus_sched_handle_t sched[DISPLAY_MANAGER_MAX_BUSES];
+    dm_display_t displays[DISPLAY_MANAGER_MAX_PANELS];
+    uint8_t count;
+    draw_arena_handle_t arena;
+    size_t buf_pixels;
+    portMUX_TYPE lock;
+    int64_t report_us;
+    draw_arena_stats_t report_arena;    // Arena counters at the last report
+} s_dm = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+// Panel transfer-done callback (ISR): hand the draw buffer back to LVGL,
+// and the lease back to the arena once the frame's last tile is out
+static void IRAM_ATTR dm_flush_done_cb(void *user_ctx)
+{
+    dm_display_t *d = user_ctx;
+    void *tiles[2] = { NULL, NULL };
+
+    if (++d->done == d->last_seq) {
+        d->frames++;
+        portENTER_CRITICAL_SAFE(&s_dm.lock);
+        if (!d->rendering) {
+            tiles[0] = d->lease[0];
+            tiles[1] = d->lease[1];
+            d->lease[0] = d->lease[1] = NULL;
+        }
+        portEXIT_CRITICAL_SAFE(&s_dm.lock);
+    }
+    bool woken = draw_arena_release(s_dm.arena, tiles[0]);
+    woken |= draw_arena_release(s_dm.arena, tiles[1]);
+    lv_disp_flush_ready(&d->drv);
+    if (woken && xPortInIsrContext()) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+// LVGL is about to render this display: lease draw buffers for it
+static void dm_render_start_cb(lv_disp_drv_t *drv)
+{
+    dm_display_t *d = drv->user_data;
+
+    portENTER_CRITICAL(&s_dm.lock);
+    bool held = d->lease[0] != NULL;
+    d->rendering = true;
+    portEXIT_CRITICAL(&s_dm.lock);
+    if (held) {
+        return;     // Previous frame's last tile still on the bus
+    }
+
+    void *tiles[2];
+    draw_arena_lease(s_dm.arena, tiles, portMAX_DELAY);
+    d->lease[0] = tiles[0];
+    d->lease[1] = tiles[1];
+    // Without a second tile LVGL renders single-buffered until the next lease
+    lv_disp_draw_buf_init(&d->draw_buf, tiles[0], tiles[1], s_dm.buf_pixels);
+}
+
+// LVGL flush callback: queue the tile on this display's panel
+static void dm_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    dm_display_t *d = drv->user_data;
+
+    uint32_t seq = ++d->submitted;
+    if (lv_disp_flush_is_last(drv)) {
+        d->last_seq = seq;
+        // From here the lease can go back once this tile is done
+        portENTER_CRITICAL(&s_dm.lock);
+        d->rendering = false;
+        portEXIT_CRITICAL(&s_dm.lock);
+    }
+    esp_err_t ret = st77916_panel_draw_bitmap(d->panel, area->x1, area->y1,
+                                              area->x2 + 1, area->y2 + 1, color_p);
+    if (ret != ESP_OK) {
+        // Driver reports no completion for a failed tile
+        dm_flush_done_cb(d);
+    }
+}
+
+// LVGL rounder: shrink invalidated areas to the visible part of the glass
+static void dm_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area)
+{
+    dm_display_t *d = drv->user_data;
+    int x_start = area->x1;
+    int y_start = area->y1;
+    int x_end   = area->x2 + 1;
+    int y_end   = area->y2 + 1;
+
+    if (!st77916_panel_visible_area(d->panel, &x_start, &y_start, &x_end, &y_end)) {
+        // The rounder cannot drop an area; keep a single (clipped) pixel
+        area->x2 = area->x1;
+        area->y2 = area->y1;
+        return;
+    }
+    area->x1 = x_start;
+    area->y1 = y_start;
+    area->x2 = x_end - 1;
+    area->y2 = y_end - 1;
+}
+
+// Draw-buffer arena: internal RAM renders fastest, PSRAM if it runs out
+static esp_err_t dm_arena_init(size_t tile_bytes, uint8_t num_tiles)
+{
+    esp_err_t ret = draw_arena_new(tile_bytes, num_tiles, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+                                   &s_dm.arena);
+    if (ret == ESP_ERR_NO_MEM) {
+        ESP_LOGW(TAG, "No internal RAM for %d draw tiles, using PSRAM", num_tiles);
+        ret = draw_arena_new(tile_bytes, num_tiles, MALLOC_CAP_SPIRAM, &s_dm.arena);
+    }
+    return ret;
+}
+
+// Pulse the shared reset line once, before any panel is brought up; the
+// panels' own bring-up then skips the hardware reset
+static void dm_reset_panels(int rst_gpio)
+{
+    if (rst_gpio < 0) {
+        return;
+    }
+    gpio_config_t io_conf = {
+        .mode = GPIO_MODE_OUTPUT,
+        .pin_bit_mask = 1ULL << rst_gpio,
+    };
+    gpio_config(&io_conf);
+    gpio_set_level(rst_gpio, 0);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    gpio_set_level(rst_gpio, 1);
+    vTaskDelay(pdMS_TO_TICKS(120));
+}
+
+static esp_err_t dm_add_display(dm_display_t *d, const display_manager_panel_t *desc,
+                                const uint8_t *clients_on_bus)
+{
+    const display_manager_config_t *cfg = s_dm.config;
+    esp_err_t ret;
+
+    d->desc = desc;
+    esp_lcd_panel_io_spi_config_t io_config = {
+        .cs_gpio_num       = desc->cs_gpio,
+        .dc_gpio_num       = -1,
+        .spi_mode          = 3,
+        .pclk_hz           = cfg->pclk_hz,
+        .trans_queue_depth = cfg->trans_queue_depth,
+        .lcd_cmd_bits      = 32,
+        .lcd_param_bits    = 8,
+        .flags             = { .quad_mode = true },
+    };
+    ret = esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)cfg->hosts[desc->bus], &io_config, &d->io);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "%s: panel IO failed: %s", desc->name, esp_err_to_name(ret));
+        return ret;
+    }
+
+    // Clients are numbered in registration order, one per panel on the bus
+    d->sched_client = clients_on_bus[desc->bus];
+    const st77916_panel_config_t panel_config = {
+        .rst_gpio        = -1,
+        .max_tile_pixels = cfg->h_res * cfg->buf_lines,
+        .pool_bufs       = 2,
+        .chunk_bytes     = cfg->chunk_bytes,
+        .h_res           = cfg->h_res,
+        .v_res           = cfg->v_res,
+        .round_clip      = cfg->round_clip,
+        .pixel_format    = cfg->pixel_format,
+        .shadow_fb       = cfg->shadow_fb,
+        .on_flush_done   = dm_flush_done_cb,
+        .user_ctx        = d,
+        .transport       = ST77916_TRANSPORT_PANEL_IO,
+        .async_init      = true,
+        .splash          = cfg->splash,
+        .bus_sched       = s_dm.sched[desc->bus],
+        .bus_weight      = desc->bus_weight,
+    };
+    ret = st77916_panel_new(d->io, &panel_config, &d->panel);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "%s: panel init failed: %s", desc->name, esp_err_to_name(ret));
+        return ret;
+    }
+
+    // Buffers are leased per refresh, see dm_render_start_cb()
+    lv_disp_draw_buf_init(&d->draw_buf, NULL, NULL, s_dm.buf_pixels);
+
+    lv_disp_drv_init(&d->drv);
+    d->drv.hor_res    = cfg->h_res;
+    d->drv.ver_res    = cfg->v_res;
+    d->drv.flush_cb   = dm_flush_cb;
+    d->drv.rounder_cb = dm_rounder_cb;
+    d->drv.render_start_cb = dm_render_start_cb;
+    d->drv.draw_buf   = &d->draw_buf;
+    d->drv.user_data  = d;
+    d->disp = lv_disp_drv_register(&d->drv);
+    if (!d->disp) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t display_manager_init(const display_manager_config_t *config)
+{
+    esp_err_t ret;
+
+    if (!config || !config->panels || !config->hosts || s_dm.config ||
+        config->num_panels == 0 || config->num_panels > DISPLAY_MANAGER_MAX_PANELS ||
+        config->num_buses == 0 || config->num_buses > DISPLAY_MANAGER_MAX_BUSES ||
+        config->buf_lines == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (uint8_t i = 0; i < config->num_panels; i++) {
+        if (config->panels[i].bus >= config->num_buses) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    s_dm.config = config;
+
+    uint8_t slots = config->bus_slots ? config->bus_slots : DM_BUS_SLOTS_DEFAULT;
+    for (uint8_t b = 0; b < config->num_buses; b++) {
+        ret = st77916_bus_sched_new(slots, &s_dm.sched[b]);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    s_dm.buf_pixels = (size_t)config->h_res * config->buf_lines;
+    uint8_t tiles = config->arena_tiles ? config->arena_tiles : DM_ARENA_TILES_DEFAULT;
+    ret = dm_arena_init(s_dm.buf_pixels * sizeof(lv_color_t), tiles);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    dm_reset_panels(config->rst_gpio);
+
+    uint8_t clients_on_bus[DISPLAY_MANAGER_MAX_BUSES] = {0};
+    for (uint8_t i = 0; i < config->num_panels; i++) {
+        const display_manager_panel_t *desc = &config->panels[i];
+        ret = dm_add_display(&s_dm.displays[i], desc, clients_on_bus);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        clients_on_bus[desc->bus]++;
+        s_dm.count++;
+    }
+    lv_disp_set_default(s_dm.displays[0].disp);
+
+    s_dm.report_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "%d panels on %d bus(es), %d transfer slots per bus",
+             config->num_panels, config->num_buses, slots);
+    return ESP_OK;
+}
+
+esp_err_t display_manager_wait_ready(TickType_t timeout)
+{
+    esp_err_t first_err = ESP_OK;
+    for (uint8_t i = 0; i < s_dm.count; i++) {
+        esp_err_t ret = st77916_panel_wait_ready(s_dm.displays[i].panel, timeout);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "%s: bring-up failed: %s", s_dm.displays[i].desc->name, esp_err_to_name(ret));
+            if (first_err == ESP_OK) {
+                first_err = ret;
+            }
+        }
+    }
+    return first_err;
+}
+
+uint8_t display_manager_count(void)
+{
+    return s_dm.count;
+}
+
+lv_disp_t *display_manager_get_disp(uint8_t index)
+{
+    return (index < s_dm.count) ? s_dm.displays[index].disp : NULL;
+}
+
+st77916_panel_handle_t display_manager_get_panel(uint8_t index)
+{
+    return (index < s_dm.count) ? s_dm.displays[index].panel : NULL;
+}
+
+void display_manager_report(void)
+{
+    int64_t now_us = esp_timer_get_time();
+    int64_t window_us = now_us - s_dm.report_us;
+    if (s_dm.count == 0 || window_us <= 0) {
+        return;
+    }
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < s_dm.count; i++) {
+        dm_display_t *d = &s_dm.displays[i];
+        uint32_t frames = d->frames;
+        uint32_t n = frames - d->report_frames;
+        d->report_frames = frames;
+        total += n;
+
+        st77916_bus_sched_stats_t bs;
+        st77916_bus_sched_get_stats(s_dm.sched[d->desc->bus], d->sched_client, &bs);
+        int64_t fps_x10 = ((int64_t)n * 10000000) / window_us;
+        ESP_LOGI(TAG, "%-6s | bus %d w%d | %lld.%lld fps | slot grants %lu, waited %lu (%llu us)",
+                 d->desc->name, d->desc->bus, d->desc->bus_weight ? d->desc->bus_weight : 1,
+                 fps_x10 / 10, fps_x10 % 10,
+                 (unsigned long)bs.grants, (unsigned long)bs.waits, bs.wait_us);
+    }
+    int64_t total_x10 = ((int64_t)total * 10000000) / window_us;
+    ESP_LOGI(TAG, "all    | %lld.%lld frames/s over %d panels",
+             total_x10 / 10, total_x10 % 10, s_dm.count);
+
+    // Waits with free tiles at 0 mean the pool, not the bus, limits the frame rate
+    draw_arena_stats_t as;
+    draw_arena_get_stats(s_dm.arena, &as);
+    uint32_t leases = as.leases - s_dm.report_arena.leases;
+    ESP_LOGI(TAG, "arena  | %d tiles, min free %d | %lu leases: %lu single-buffered, %lu waited (%llu us)",
+             as.tiles, as.min_free, (unsigned long)leases,
+             (unsigned long)(as.single - s_dm.report_arena.single),
+             (unsigned long)(as.waits - s_dm.report_arena.waits),
+             as.wait_us - s_dm.report_arena.wait_us);
+    s_dm.report_arena = as;
+    s_dm.report_us = now_us;
+}
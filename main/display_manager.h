@@ -0,0 +1,116 @@
+/**
+ * Multi-Panel Display Manager
+ *
+ * Creates one ST77916 panel per CS line, each with its own panel IO and
+ * LVGL display. Draw buffers are leased from a shared arena while a
+ * display renders. Panels on the same QSPI bus share a bus
+ * scheduler, so their tiles interleave on the bus by weight instead of in
+ * arrival order. All displays are rendered by the single LVGL task.
+ */
+
+#ifndef DISPLAY_MANAGER_H
+#define DISPLAY_MANAGER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "driver/spi_master.h"
+#include "lvgl.h"
+#include "st77916_panel.h"
+#include "draw_arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of panels the manager drives */
+#define DISPLAY_MANAGER_MAX_PANELS  ST77916_BUS_SCHED_MAX_CLIENTS
+
+/** Maximum number of QSPI buses the panels are spread over */
+#define DISPLAY_MANAGER_MAX_BUSES   2
+
+/**
+ * @brief One panel of the cluster
+ */
+typedef struct {
+    const char *name;           /*!< Label used in reports */
+    int cs_gpio;                /*!< Chip select GPIO */
+    uint8_t bus;                /*!< Index into display_manager_config_t::hosts */
+    uint8_t bus_weight;         /*!< Share of its bus under contention (0 counts as 1) */
+} display_manager_panel_t;
+
+/**
+ * @brief Display manager configuration
+ *
+ * The SPI buses must already be initialized with spi_bus_initialize() and
+ * LVGL with lv_init().
+ */
+typedef struct {
+    const display_manager_panel_t *panels;      /*!< Panel descriptors, num_panels entries */
+    uint8_t num_panels;
+    const spi_host_device_t *hosts;             /*!< QSPI buses, num_buses entries */
+    uint8_t num_buses;
+    uint8_t bus_slots;          /*!< Color transfers in flight per bus (0 = 2) */
+    int rst_gpio;               /*!< Reset line shared by all panels, -1 if not wired */
+    uint16_t h_res;
+    uint16_t v_res;
+    uint16_t buf_lines;         /*!< Lines per draw-buffer tile */
+    uint8_t arena_tiles;        /*!< Tiles shared by all displays (0 = 4); a rendering display
+                                     leases two, so this bounds how many render at once */
+    int pclk_hz;
+    uint8_t trans_queue_depth;  /*!< Panel IO transaction queue depth */
+    size_t chunk_bytes;         /*!< Staging chunk size, see st77916_panel_config_t */
+    st77916_pixel_format_t pixel_format;
+    bool round_clip;
+    bool shadow_fb;
+    const st77916_splash_t *splash;             /*!< Shown on every panel at DISPON, or NULL */
+} display_manager_config_t;
+
+/**
+ * @brief Create all panels and register their LVGL displays
+ *
+ * Panels are brought up in the background; the first display becomes
+ * LVGL's default. Call after lv_init(), before the LVGL task starts.
+ *
+ * @param config Cluster configuration, must stay valid for the lifetime of the application
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t display_manager_init(const display_manager_config_t *config);
+
+/**
+ * @brief Wait until every panel has finished bring-up
+ *
+ * @param timeout Maximum time to wait per panel
+ * @return ESP_OK, ESP_ERR_TIMEOUT, or the first bring-up error
+ */
+esp_err_t display_manager_wait_ready(TickType_t timeout);
+
+/**
+ * @brief Number of panels created by display_manager_init()
+ */
+uint8_t display_manager_count(void);
+
+/**
+ * @brief LVGL display of a panel, NULL if index is out of range
+ */
+lv_disp_t *display_manager_get_disp(uint8_t index);
+
+/**
+ * @brief Driver handle of a panel, NULL if index is out of range
+ */
+st77916_panel_handle_t display_manager_get_panel(uint8_t index);
+
+/**
+ * @brief Log per-panel and aggregate frame rates since the previous report
+ *
+ * Also logs each bus scheduler's grants and slot waits per panel, and the
+ * draw-buffer arena's lease and wait counters.
+ */
+void display_manager_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_MANAGER_H */
@@ -0,0 +1,107 @@
+/**
+ * Shared LVGL Draw-Buffer Arena
+ *
+ * Free tiles sit in a queue: leasing receives from it (blocking only for
+ * the first tile), and the transfer-done ISR sends tiles back. Counters
+ * are only updated by the leasing task.
+ */
+
+#include "draw_arena.h"
+#include "freertos/queue.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "draw_arena";
+
+struct draw_arena_t {
+    QueueHandle_t free_q;
+    void *tiles[DRAW_ARENA_MAX_TILES];
+    draw_arena_stats_t stats;
+};
+
+esp_err_t draw_arena_new(size_t tile_bytes, uint8_t num_tiles, uint32_t caps,
+                         draw_arena_handle_t *ret_arena)
+{
+    if (tile_bytes == 0 || num_tiles < 2 || num_tiles > DRAW_ARENA_MAX_TILES || !ret_arena) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct draw_arena_t *arena = heap_caps_calloc(1, sizeof(*arena), MALLOC_CAP_INTERNAL);
+    if (!arena) {
+        return ESP_ERR_NO_MEM;
+    }
+    arena->free_q = xQueueCreate(num_tiles, sizeof(void *));
+    if (!arena->free_q) {
+        heap_caps_free(arena);
+        return ESP_ERR_NO_MEM;
+    }
+    for (uint8_t i = 0; i < num_tiles; i++) {
+        arena->tiles[i] = heap_caps_malloc(tile_bytes, caps);
+        if (!arena->tiles[i]) {
+            ESP_LOGE(TAG, "Failed to allocate tile %d (%d bytes)", i, tile_bytes);
+            for (uint8_t j = 0; j < i; j++) {
+                heap_caps_free(arena->tiles[j]);
+            }
+            vQueueDelete(arena->free_q);
+            heap_caps_free(arena);
+            return ESP_ERR_NO_MEM;
+        }
+        xQueueSend(arena->free_q, &arena->tiles[i], 0);
+    }
+    arena->stats.tiles = num_tiles;
+    arena->stats.min_free = num_tiles;
+
+    ESP_LOGI(TAG, "%d tiles of %d bytes", num_tiles, tile_bytes);
+    *ret_arena = arena;
+    return ESP_OK;
+}
+
+uint8_t draw_arena_lease(draw_arena_handle_t arena, void *tiles[2], TickType_t timeout)
+{
+    tiles[0] = tiles[1] = NULL;
+    arena->stats.leases++;
+
+    if (xQueueReceive(arena->free_q, &tiles[0], 0) != pdTRUE) {
+        arena->stats.waits++;
+        int64_t start_us = esp_timer_get_time();
+        BaseType_t got = xQueueReceive(arena->free_q, &tiles[0], timeout);
+        arena->stats.wait_us += esp_timer_get_time() - start_us;
+        if (got != pdTRUE) {
+            return 0;
+        }
+    }
+    uint8_t n = 1;
+    if (xQueueReceive(arena->free_q, &tiles[1], 0) == pdTRUE) {
+        n = 2;
+    } else {
+        arena->stats.single++;
+    }
+
+    UBaseType_t free_now = uxQueueMessagesWaiting(arena->free_q);
+    if (free_now < arena->stats.min_free) {
+        arena->stats.min_free = free_now;
+    }
+    return n;
+}
+
+bool IRAM_ATTR draw_arena_release(draw_arena_handle_t arena, void *tile)
+{
+    if (!tile) {
+        return false;
+    }
+    if (!xPortInIsrContext()) {
+        xQueueSend(arena->free_q, &tile, 0);
+        return false;
+    }
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(arena->free_q, &tile, &woken);
+    return woken == pdTRUE;
+}
+
+void draw_arena_get_stats(draw_arena_handle_t arena, draw_arena_stats_t *out_stats)
+{
+    if (arena && out_stats) {
+        *out_stats = arena->stats;
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * Shared LVGL Draw-Buffer Arena
+ *
+ * A fixed pool of equally sized render tiles in internal RAM. A display
+ * leases one or two tiles when LVGL starts rendering it and gives them
+ * back once its last tile has been sent, so idle displays hold no memory
+ * and the pool is sized to how many renders overlap on the bus rather
+ * than to the number of panels.
+ */
+
+#ifndef DRAW_ARENA_H
+#define DRAW_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of tiles in an arena */
+#define DRAW_ARENA_MAX_TILES    16
+
+typedef struct draw_arena_t *draw_arena_handle_t;
+
+/**
+ * @brief Arena counters
+ */
+typedef struct {
+    uint32_t leases;            /*!< draw_arena_lease() calls */
+    uint32_t single;            /*!< Leases that got one tile only (display renders single-buffered) */
+    uint32_t waits;             /*!< Leases that had to wait for the first tile */
+    uint64_t wait_us;           /*!< Time spent waiting */
+    uint8_t tiles;              /*!< Tiles in the arena */
+    uint8_t min_free;           /*!< Fewest tiles ever free at once */
+} draw_arena_stats_t;
+
+/**
+ * @brief Allocate an arena
+ *
+ * @param tile_bytes Size of one tile
+ * @param num_tiles Number of tiles (2..DRAW_ARENA_MAX_TILES)
+ * @param caps Heap capabilities of the tiles, e.g. MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+ * @param ret_arena Returned arena handle
+ */
+esp_err_t draw_arena_new(size_t tile_bytes, uint8_t num_tiles, uint32_t caps,
+                         draw_arena_handle_t *ret_arena);
+
+/**
+ * @brief Lease up to two tiles
+ *
+ * Waits for the first tile; the second is only taken if one is free right
+ * away. Task context only.
+ *
+ * @param[out] tiles Leased tiles; tiles[1] is NULL when only one was free
+ * @param timeout Maximum time to wait for the first tile
+ * @return Number of tiles leased, 0 on timeout
+ */
+uint8_t draw_arena_lease(draw_arena_handle_t arena, void *tiles[2], TickType_t timeout);
+
+/**
+ * @brief Return a leased tile (NULL is ignored)
+ *
+ * Callable from the transfer-done ISR as well as from a task.
+ *
+ * @return true if a higher priority task was woken (ISR context)
+ */
+bool draw_arena_release(draw_arena_handle_t arena, void *tile);
+
+/**
+ * @brief Read the arena's counters
+ */
+void draw_arena_get_stats(draw_arena_handle_t arena, draw_arena_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRAW_ARENA_H */
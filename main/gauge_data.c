@@ -0,0 +1,288 @@
+/**
+ * Gauge Data Snapshot
+ *
+ * Sequence lock with GCC atomics. The fences pair up as in the Linux
+ * seqlock: the writer's release fence keeps the odd sequence ahead of the
+ * data stores, the reader's acquire fence keeps the data loads ahead of
+ * the sequence re-check.
+ */
+
+#include "gauge_data.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#endif
+
+// gauge_data_value() indexes the floats from the start of the struct
+_Static_assert(offsetof(gauge_data_t, rpm) == GAUGE_RPM * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, coolant_temp) == GAUGE_COOLANT_TEMP * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, battery_voltage) == GAUGE_BATTERY_VOLTAGE * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, speed) == GAUGE_SPEED * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, oil_pressure) == GAUGE_OIL_PRESSURE * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, fuel_level) == GAUGE_FUEL_LEVEL * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, iac) == GAUGE_IAC * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, map) == GAUGE_MAP * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, mat) == GAUGE_MAT * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, afr) == GAUGE_AFR * sizeof(float), "signal order");
+_Static_assert(offsetof(gauge_data_t, engine_running) == GAUGE_NUM_SIGNALS * sizeof(float),
+               "every float value is a signal");
+_Static_assert(GAUGE_NUM_SIGNALS <= 32, "signal masks are 32 bits");
+
+// Interval EMA weight 1/8: follows a rate change within a few dozen receives
+#define INTERVAL_EMA_SHIFT      3
+
+static const char *const s_signal_names[GAUGE_NUM_SIGNALS] = {
+    [GAUGE_RPM]             = "rpm",
+    [GAUGE_COOLANT_TEMP]    = "coolant_temp",
+    [GAUGE_BATTERY_VOLTAGE] = "battery_voltage",
+    [GAUGE_SPEED]           = "speed",
+    [GAUGE_OIL_PRESSURE]    = "oil_pressure",
+    [GAUGE_FUEL_LEVEL]      = "fuel_level",
+    [GAUGE_IAC]             = "iac",
+    [GAUGE_MAP]             = "map",
+    [GAUGE_MAT]             = "mat",
+    [GAUGE_AFR]             = "afr",
+};
+
+const char *gauge_signal_name(gauge_signal_t signal)
+{
+    return (unsigned)signal < GAUGE_NUM_SIGNALS ? s_signal_names[signal] : "?";
+}
+
+void gauge_data_received(gauge_data_t *g, uint32_t signals, uint32_t now_ms)
+{
+    signals &= GAUGE_ALL_SIGNALS;
+    while (signals) {
+        int i = __builtin_ctz(signals);
+        signals &= signals - 1;
+        float interval = (float)(now_ms - g->rx_ms[i]);
+        float *mean = &g->interval_ms[i];
+        if (g->fresh & GAUGE_BIT(i)) {
+            *mean += (interval - *mean) / (1 << INTERVAL_EMA_SHIFT);
+        } else {
+            // A slow signal goes stale before its second receive, so that
+            // gap seeds the mean; later gaps while stale would only skew it
+            if (*mean == 0 && g->rx_ms[i] != 0) {
+                *mean = interval;
+            }
+            g->fresh |= GAUGE_BIT(i);
+            g->changed |= GAUGE_BIT(i);
+        }
+        g->rx_ms[i] = now_ms;
+    }
+}
+
+void gauge_data_set(gauge_data_t *g, gauge_signal_t signal, float value, uint32_t now_ms)
+{
+    float *field = (float *)((uint8_t *)g + signal * sizeof(float));
+    if (memcmp(field, &value, sizeof(value)) != 0) {
+        *field = value;
+        g->changed |= GAUGE_BIT(signal);
+    }
+    gauge_data_received(g, GAUGE_BIT(signal), now_ms);
+}
+
+uint32_t gauge_data_expire(gauge_data_t *g, uint32_t now_ms)
+{
+    uint32_t stale = 0;
+    for (uint32_t fresh = g->fresh; fresh; fresh &= fresh - 1) {
+        int i = __builtin_ctz(fresh);
+        float limit = g->interval_ms[i] * GAUGE_STALE_INTERVALS;
+        if (limit < GAUGE_STALE_MIN_MS) {
+            limit = GAUGE_STALE_MIN_MS;
+        }
+        // Signed: a receive stamped after now_ms is age <= 0, not ~49 days
+        if ((float)(int32_t)(now_ms - g->rx_ms[i]) > limit) {
+            stale |= GAUGE_BIT(i);
+        }
+    }
+    g->fresh &= ~stale;
+    g->changed |= stale;
+    return stale;
+}
+
+void gauge_snapshot_publish(gauge_snapshot_t *snap, const gauge_data_t *data)
+{
+    uint32_t seq = __atomic_load_n(&snap->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&snap->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&snap->data, data, sizeof(*data));
+    __atomic_store_n(&snap->seq, seq + 2, __ATOMIC_RELEASE);
+    // After the data: whoever sees these bits finds this publish or a later one
+    if (data->changed) {
+        __atomic_fetch_or(&snap->pending, data->changed, __ATOMIC_RELEASE);
+    }
+}
+
+uint32_t gauge_snapshot_read(const gauge_snapshot_t *snap, gauge_data_t *out)
+{
+    uint32_t retries = 0;
+    while (1) {
+        uint32_t seq = __atomic_load_n(&snap->seq, __ATOMIC_ACQUIRE);
+        if (!(seq & 1)) {
+            memcpy(out, &snap->data, sizeof(*out));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&snap->seq, __ATOMIC_RELAXED) == seq) {
+                return retries;
+            }
+        }
+        retries++;
+    }
+}
+
+uint32_t gauge_snapshot_take(gauge_snapshot_t *snap, gauge_data_t *out)
+{
+    uint32_t changed = __atomic_exchange_n(&snap->pending, 0, __ATOMIC_ACQUIRE);
+    gauge_snapshot_read(snap, out);
+    return changed;
+}
+
+uint32_t gauge_snapshot_version(const gauge_snapshot_t *snap)
+{
+    return __atomic_load_n(&snap->seq, __ATOMIC_ACQUIRE) >> 1;
+}
+
+#ifdef ESP_PLATFORM
+
+#define BENCH_TASK_PRIORITY     10
+#define BENCH_TASK_STACK        3072
+
+// Publish numbers stay exact in a float below 2^24
+#define BENCH_SEQ_MASK          0xFFFFFF
+
+static struct {
+    gauge_snapshot_t snap;
+    volatile bool stop;
+    uint32_t period_us;
+    TaskHandle_t caller;
+    gauge_snapshot_bench_t res;
+} s_bench;
+
+// Every float field carries the publish number, so a copy mixing two
+// publishes has fields that disagree
+static void bench_fill(gauge_data_t *d, uint32_t n)
+{
+    float v = (float)(n & BENCH_SEQ_MASK);
+    d->rpm = d->coolant_temp = d->battery_voltage = d->speed = v;
+    d->oil_pressure = d->fuel_level = d->iac = d->map = d->mat = d->afr = v;
+    d->last_update_ms = n & BENCH_SEQ_MASK;
+}
+
+static bool bench_torn(const gauge_data_t *d)
+{
+    float v = (float)d->last_update_ms;
+    return d->rpm != v || d->coolant_temp != v || d->battery_voltage != v || d->speed != v ||
+           d->oil_pressure != v || d->fuel_level != v || d->iac != v || d->map != v ||
+           d->mat != v || d->afr != v;
+}
+
+static void bench_writer_task(void *arg)
+{
+    gauge_data_t d = {0};
+    uint32_t n = 0;
+    uint32_t max_cycles = 0;
+    int64_t next_us = esp_timer_get_time();
+
+    while (!s_bench.stop) {
+        if (s_bench.period_us) {
+            // Spin rather than sleep: periods are far below a tick
+            while (esp_timer_get_time() < next_us) {
+            }
+            next_us += s_bench.period_us;
+        }
+        bench_fill(&d, ++n);
+        d.publish_us = esp_timer_get_time();
+        uint32_t c0 = esp_cpu_get_cycle_count();
+        gauge_snapshot_publish(&s_bench.snap, &d);
+        uint32_t cycles = esp_cpu_get_cycle_count() - c0;
+        if (cycles > max_cycles) {
+            max_cycles = cycles;
+        }
+    }
+    s_bench.res.publishes = n;
+    s_bench.res.publish_cycles_max = max_cycles;
+    xTaskNotifyGive(s_bench.caller);
+    vTaskDelete(NULL);
+}
+
+static void bench_reader_task(void *arg)
+{
+    gauge_snapshot_bench_t *r = &s_bench.res;
+    gauge_data_t d;
+    uint32_t last_seen = 0;
+    uint32_t fresh = 0;
+    uint64_t sum_cycles = 0;
+    uint64_t sum_age_us = 0;
+
+    while (!s_bench.stop) {
+        uint32_t c0 = esp_cpu_get_cycle_count();
+        uint32_t retries = gauge_snapshot_read(&s_bench.snap, &d);
+        uint32_t cycles = esp_cpu_get_cycle_count() - c0;
+        int64_t now_us = esp_timer_get_time();
+
+        r->reads++;
+        r->retries += retries;
+        if (retries > r->max_retries) r->max_retries = retries;
+        sum_cycles += cycles;
+        if (cycles > r->read_cycles_max) r->read_cycles_max = cycles;
+        if (bench_torn(&d)) {
+            r->torn++;
+        }
+        if (d.last_update_ms != last_seen) {
+            // First read returning this publish: how long it took to show up
+            last_seen = d.last_update_ms;
+            uint32_t age_us = (uint32_t)(now_us - d.publish_us);
+            sum_age_us += age_us;
+            if (age_us > r->age_us_max) r->age_us_max = age_us;
+            fresh++;
+        }
+    }
+    r->read_cycles_avg = r->reads ? (uint32_t)(sum_cycles / r->reads) : 0;
+    r->age_us_avg = fresh ? (uint32_t)(sum_age_us / fresh) : 0;
+    xTaskNotifyGive(s_bench.caller);
+    vTaskDelete(NULL);
+}
+
+esp_err_t gauge_snapshot_bench(int writer_core, uint32_t publish_period_us,
+                               uint32_t duration_ms, gauge_snapshot_bench_t *out)
+{
+    if (!out || duration_ms == 0 || writer_core < 0 || writer_core > 1) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(&s_bench, 0, sizeof(s_bench));
+    s_bench.period_us = publish_period_us;
+    s_bench.caller = xTaskGetCurrentTaskHandle();
+
+    // Both cores spin for the whole run; stay above them to stop it
+    UBaseType_t prio = uxTaskPriorityGet(NULL);
+    vTaskPrioritySet(NULL, BENCH_TASK_PRIORITY + 1);
+
+    if (xTaskCreatePinnedToCore(bench_writer_task, "snap_wr", BENCH_TASK_STACK, NULL,
+                                BENCH_TASK_PRIORITY, NULL, writer_core) != pdPASS) {
+        vTaskPrioritySet(NULL, prio);
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreatePinnedToCore(bench_reader_task, "snap_rd", BENCH_TASK_STACK, NULL,
+                                BENCH_TASK_PRIORITY, NULL, !writer_core) != pdPASS) {
+        s_bench.stop = true;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskPrioritySet(NULL, prio);
+        return ESP_ERR_NO_MEM;
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(duration_ms));
+    s_bench.stop = true;
+    for (int done = 0; done < 2; ) {
+        done += ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    vTaskPrioritySet(NULL, prio);
+    *out = s_bench.res;
+    return ESP_OK;
+}
+
+#endif
@@ -0,0 +1,217 @@
+/**
+ * Gauge Data Snapshot
+ *
+ * The ingestion task (CAN, VSS, analog senders) owns a working copy of
+ * gauge_data_t and publishes it through a sequence lock; the renderer
+ * takes consistent copies without either side ever waiting on the other.
+ * The writer bumps the sequence to odd, copies the data and bumps it back
+ * to even; a reader retries when it saw an odd sequence or the sequence
+ * changed during its copy. With one writer and a copy of a few dozen
+ * bytes, a retry is rare and costs one more copy.
+ *
+ * Each value is a signal with its own receive time, mean receive interval
+ * and freshness bit, so one dead sensor shows up even while others keep
+ * streaming. A signal goes stale after GAUGE_STALE_INTERVALS of its own
+ * mean interval (at least GAUGE_STALE_MIN_MS) without a receive. The
+ * writer collects the signals whose value, warning or freshness changed
+ * into a bitmask, and the renderer takes the bits accumulated since its
+ * last take in one atomic exchange, so it redraws only those widgets.
+ *
+ * The core is plain C and builds off-target; the benchmark is ESP-IDF only.
+ */
+
+#ifndef GAUGE_DATA_H
+#define GAUGE_DATA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Signals: the float values of gauge_data_t, in field order
+ */
+typedef enum {
+    GAUGE_RPM,
+    GAUGE_COOLANT_TEMP,
+    GAUGE_BATTERY_VOLTAGE,
+    GAUGE_SPEED,
+    GAUGE_OIL_PRESSURE,
+    GAUGE_FUEL_LEVEL,
+    GAUGE_IAC,
+    GAUGE_MAP,
+    GAUGE_MAT,
+    GAUGE_AFR,
+    GAUGE_NUM_SIGNALS,
+} gauge_signal_t;
+
+/** Signal bit in gauge_data_t::changed, fresh and gauge_snapshot_take() */
+#define GAUGE_BIT(signal)       (1u << (signal))
+#define GAUGE_ALL_SIGNALS       (GAUGE_BIT(GAUGE_NUM_SIGNALS) - 1)
+
+/** Silent intervals before a signal is stale, and the shortest stale limit */
+#define GAUGE_STALE_INTERVALS   4
+#define GAUGE_STALE_MIN_MS      250
+
+/**
+ * @brief Values shown on the cluster
+ */
+typedef struct {
+    // Primary gauges (signals, in gauge_signal_t order)
+    float rpm;                  /*!< 0-6000 RPM */
+    float coolant_temp;         /*!< -40 to 260 °F */
+    float battery_voltage;      /*!< 0-20 V */
+    float speed;                /*!< 0-120 MPH */
+    float oil_pressure;         /*!< 0-100 PSI */
+    float fuel_level;           /*!< 0-100 % */
+
+    // Diagnostic data
+    float iac;                  /*!< Idle air control position, 0-100 % */
+    float map;                  /*!< Manifold pressure, 0-999 kPa */
+    float mat;                  /*!< Manifold air temperature, -40 to 260 °F */
+    float afr;                  /*!< Air/fuel ratio, 2-20 */
+
+    // Status flags
+    bool engine_running;
+    bool low_oil_pressure;
+    bool low_battery;
+    bool high_coolant_temp;
+
+    // Per signal: bit or index n is gauge_signal_t n
+    uint32_t changed;           /*!< Value, warning or freshness changed since the last publish */
+    uint32_t fresh;             /*!< Received within the stale limit */
+    uint32_t rx_ms[GAUGE_NUM_SIGNALS];      /*!< Last receive, 0 = never */
+    float interval_ms[GAUGE_NUM_SIGNALS];   /*!< Mean receive interval (EMA), 0 until known */
+
+    uint32_t last_update_ms;    /*!< Last CAN frame of any kind (ECU alive) */
+    int64_t publish_us;         /*!< When this copy was published */
+} gauge_data_t;
+
+/**
+ * @brief A signal's value
+ */
+static inline float gauge_data_value(const gauge_data_t *g, gauge_signal_t signal)
+{
+    return *(const float *)((const uint8_t *)g + signal * sizeof(float));
+}
+
+/**
+ * @brief Mean receive rate of a signal in Hz, 0 until two receives
+ */
+static inline float gauge_data_rate_hz(const gauge_data_t *g, gauge_signal_t signal)
+{
+    return g->interval_ms[signal] > 0 ? 1000.0f / g->interval_ms[signal] : 0;
+}
+
+/**
+ * @brief Signal name for logs ("rpm", "coolant_temp", ...)
+ */
+const char *gauge_signal_name(gauge_signal_t signal);
+
+/**
+ * @brief Record that signals were received (writer)
+ *
+ * Stamps them, updates their mean interval and marks newly fresh ones as
+ * changed. Value changes are marked by whoever stores the value.
+ */
+void gauge_data_received(gauge_data_t *g, uint32_t signals, uint32_t now_ms);
+
+/**
+ * @brief Store a value, mark it changed if it differs, and record the receive (writer)
+ */
+void gauge_data_set(gauge_data_t *g, gauge_signal_t signal, float value, uint32_t now_ms);
+
+/**
+ * @brief Clear the fresh bit of signals past their stale limit (writer)
+ *
+ * A signal stamped later than now_ms (received while the caller's pass
+ * was under way) is fresh.
+ *
+ * @return Signals that went stale in this call (also marked changed)
+ */
+uint32_t gauge_data_expire(gauge_data_t *g, uint32_t now_ms);
+
+/**
+ * @brief Single-writer, multi-reader published copy of gauge_data_t
+ *
+ * Zero-initialize before use.
+ */
+typedef struct {
+    uint32_t seq;               /*!< Odd while a publish is in progress */
+    uint32_t pending;           /*!< Changed bits not yet taken by gauge_snapshot_take() */
+    gauge_data_t data;
+} gauge_snapshot_t;
+
+/**
+ * @brief Publish a new copy (single writer; never waits)
+ *
+ * Adds data->changed to the bits gauge_snapshot_take() returns; the
+ * writer clears its changed mask afterwards.
+ */
+void gauge_snapshot_publish(gauge_snapshot_t *snap, const gauge_data_t *data);
+
+/**
+ * @brief Take a consistent copy (any number of readers; never blocks the writer)
+ *
+ * @param[out] out Copy of the last completed publish
+ * @return Number of retries needed (0 unless a publish overlapped the copy)
+ */
+uint32_t gauge_snapshot_read(const gauge_snapshot_t *snap, gauge_data_t *out);
+
+/**
+ * @brief Take a consistent copy and the signals changed since the last take
+ *
+ * One consumer only (the renderer): taking clears the bits. The copy is
+ * at least as new as the changes returned, so a change is never lost;
+ * at worst one is returned again with the next take.
+ *
+ * @return Changed signal bits (GAUGE_BIT), 0 if nothing changed
+ */
+uint32_t gauge_snapshot_take(gauge_snapshot_t *snap, gauge_data_t *out);
+
+/**
+ * @brief Number of completed publishes, to skip reads when nothing changed
+ */
+uint32_t gauge_snapshot_version(const gauge_snapshot_t *snap);
+
+#ifdef ESP_PLATFORM
+/**
+ * @brief Seqlock contention/latency benchmark result
+ */
+typedef struct {
+    uint32_t publishes;         /*!< Publishes by the writer core */
+    uint32_t reads;             /*!< Reads by the reader core */
+    uint32_t retries;           /*!< Read retries caused by overlapping publishes */
+    uint32_t max_retries;       /*!< Most retries of a single read */
+    uint32_t torn;              /*!< Reads returning mixed publishes (must be 0) */
+    uint32_t read_cycles_avg;   /*!< CPU cycles per read, retries included */
+    uint32_t read_cycles_max;
+    uint32_t publish_cycles_max;    /*!< Longest publish: the writer's worst stall */
+    uint32_t age_us_avg;        /*!< Publish to first read that returned it */
+    uint32_t age_us_max;
+} gauge_snapshot_bench_t;
+
+/**
+ * @brief Hammer one snapshot from two cores and measure both sides
+ *
+ * The writer is pinned to writer_core and publishes every publish_period_us
+ * (0 = back to back, worst case); the reader is pinned to the other core
+ * and reads back to back. Occupies both cores for duration_ms, so keep it
+ * well below the task watchdog timeout.
+ */
+esp_err_t gauge_snapshot_bench(int writer_core, uint32_t publish_period_us,
+                               uint32_t duration_ms, gauge_snapshot_bench_t *out);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GAUGE_DATA_H */
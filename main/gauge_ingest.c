@@ -0,0 +1,371 @@
+/**
+ * Gauge Data Ingestion
+ *
+ * Port of the Arduino sketch's setupCAN()/setupVSS()/loop(). All setup
+ * runs on the ingestion task itself: the TWAI driver and the GPIO ISR
+ * service allocate their interrupts on the calling core, which keeps CAN
+ * and VSS interrupts off the rendering core.
+ *
+ * The CAN receive task (can_bus.c) runs above everything else on that
+ * core and moves each frame, timestamped, into a ring sized for a
+ * saturated bus. The loop decodes whatever the ring holds in batches, so
+ * a slow pass (logging) delays values instead of losing frames. The
+ * senders are sampled the same way: the ADC's DMA fills frames at a fixed
+ * rate and each pass averages the decimated blocks that arrived.
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "holley_can.h"
+#include "can_ring.h"
+#include "can_bus.h"
+#include "vss.h"
+#include "sender_adc.h"
+#include "gauge_ingest.h"
+
+static const char *TAG = "ingest";
+
+#define INGEST_TASK_STACK       4096
+#define INGEST_TASK_PRIORITY    6
+// Frame ring: at 1 Mbit/s a 4-byte extended frame takes ~100 us, so 256
+// slots hold ~25 ms of a saturated bus, 2.5 loop periods
+#define CAN_RING_SLOTS          256
+
+// CAN data older than this is reported stale
+#define CAN_STALE_MS            250
+#define CAN_STALE_LOG_MS        1000
+// Debug dump interval (ESP_LOGD)
+#define DEBUG_PRINT_MS          500
+// CAN bus health report interval
+#define CAN_REPORT_MS           5000
+
+// VSS calibration (T56, calibrate per truck)
+#define VSS_PULSES_PER_MILE     8000.0f
+// Speed resolution published: finer would wake the renderer for nothing
+#define VSS_MPH_STEP            0.1f
+
+// Senders: 2 kHz per channel, a 64-sample block every 32 ms; each gauge
+// averages the blocks over its display period (fuel long, for slosh)
+#define SENDER_SAMPLE_HZ        2000
+#define OIL_DISPLAY_MS          100
+#define FUEL_DISPLAY_MS         1000
+// ADC full scale (12 dB attenuation)
+#define ADC_FULL_SCALE_V        3.3f
+
+// Oil sender: 0.5 V = 0 PSI, 4.5 V = 100 PSI
+#define OIL_V_MIN               0.5f
+#define OIL_V_SPAN              4.0f
+#define OIL_PSI_MAX             100.0f
+#define LOW_OIL_PSI             10.0f
+
+// Fuel sender divider: 3.3 V --[330R]--+--[sender]-- GND, ADC at the junction
+#define FUEL_R_KNOWN            330.0f
+#define FUEL_R_FULL             73.0f
+#define FUEL_R_EMPTY            10.0f
+
+// Block values averaged over one display period
+typedef struct {
+    int slot;                       // Channel in the block, -1 if not wired
+    uint32_t sum;
+    uint32_t blocks;
+    uint32_t since_ms;              // Last publish
+} sender_avg_t;
+
+static struct {
+    gauge_ingest_config_t cfg;
+    gauge_snapshot_t snap;
+    can_ring_t ring;
+    can_frame_t ring_slots[CAN_RING_SLOTS];
+    uint32_t can_frames;            // Frames decoded
+    gauge_data_t work;              // Working copy, ingestion task only
+    sender_avg_t oil;
+    sender_avg_t fuel;
+    vss_reading_t vss;              // Last VSS estimate
+    TaskHandle_t starter;
+    esp_err_t start_ret;
+} s_ing;
+
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static float clampf(float v, float lo, float hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// Receive exactly the catalog's frames
+static esp_err_t can_setup(void)
+{
+    const uint32_t *ids;
+    size_t num_ids = holley_can_frame_ids(&ids);
+    const can_bus_config_t bus_config = {
+        .tx_gpio       = s_ing.cfg.can_tx_gpio,
+        .rx_gpio       = s_ing.cfg.can_rx_gpio,
+        .ids           = ids,
+        .num_ids       = num_ids,
+        .accept_all    = s_ing.cfg.can_accept_all,
+        .ring          = &s_ing.ring,
+        .capture_bytes = s_ing.cfg.can_capture_bytes,
+    };
+    return can_bus_start(&bus_config);
+}
+
+static esp_err_t vss_setup(void)
+{
+    if (s_ing.cfg.vss_gpio < 0) {
+        return ESP_OK;
+    }
+    const vss_config_t vss_config = {
+        .gpio            = s_ing.cfg.vss_gpio,
+        .pulses_per_mile = VSS_PULSES_PER_MILE,
+    };
+    return vss_start(&vss_config);
+}
+
+static esp_err_t adc_setup(void)
+{
+    gpio_num_t gpios[2];
+    size_t n = 0;
+    s_ing.oil.slot = -1;
+    s_ing.fuel.slot = -1;
+    if (s_ing.cfg.oil_gpio >= 0) {
+        s_ing.oil.slot = n;
+        gpios[n++] = s_ing.cfg.oil_gpio;
+    }
+    if (s_ing.cfg.fuel_gpio >= 0) {
+        s_ing.fuel.slot = n;
+        gpios[n++] = s_ing.cfg.fuel_gpio;
+    }
+    if (n == 0) {
+        return ESP_OK;
+    }
+    const sender_adc_config_t adc_config = {
+        .gpios        = gpios,
+        .num_channels = n,
+        .sample_hz    = SENDER_SAMPLE_HZ,
+    };
+    return sender_adc_start(&adc_config);
+}
+
+// Average of the blocks since the last take, once per display period
+static bool sender_avg_take(sender_avg_t *avg, uint32_t period_ms, uint32_t now, float *volts)
+{
+    if (avg->slot < 0 || avg->blocks == 0 || now - avg->since_ms < period_ms) {
+        return false;
+    }
+    uint32_t value = (avg->sum + avg->blocks / 2) / avg->blocks;
+    avg->sum = 0;
+    avg->blocks = 0;
+    avg->since_ms = now;
+    *volts = value * (ADC_FULL_SCALE_V / SENDER_ADC_RESULT_MAX);
+    return true;
+}
+
+// Consumer: decode everything queued since the last pass, a run at a time
+static void update_can(gauge_data_t *g)
+{
+    const can_frame_t *frames;
+    uint32_t n;
+    while ((n = can_ring_peek(&s_ing.ring, &frames)) > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            holley_can_parse(&frames[i], g, (uint32_t)(frames[i].rx_us / 1000));
+        }
+        can_ring_consume(&s_ing.ring, n);
+        s_ing.can_frames += n;
+    }
+}
+
+// Warn once per burst of drops
+static void check_can_overflow(void)
+{
+    static uint32_t reported;
+    uint32_t overflows = __atomic_load_n(&s_ing.ring.overflows, __ATOMIC_RELAXED);
+    if (overflows != reported) {
+        ESP_LOGW(TAG, "CAN ring full: %" PRIu32 " frames dropped (high water %" PRIu32 "/%d)",
+                 overflows - reported, s_ing.ring.high_water, CAN_RING_SLOTS);
+        reported = overflows;
+    }
+}
+
+// VSS speed; once the sensor has pulsed it owns the speed (a stop reads
+// 0), before that the ECU's speed stands
+static void update_vss(gauge_data_t *g, uint32_t now)
+{
+    if (s_ing.cfg.vss_gpio < 0 || vss_read(&s_ing.vss) != ESP_OK || s_ing.vss.pulses == 0) {
+        return;
+    }
+    gauge_data_set(g, GAUGE_SPEED, roundf(s_ing.vss.mph / VSS_MPH_STEP) * VSS_MPH_STEP, now);
+}
+
+static void update_analog(gauge_data_t *g, uint32_t now)
+{
+    sender_adc_block_t block;
+    while (sender_adc_read(&block) == ESP_OK) {
+        if (s_ing.oil.slot >= 0) {
+            s_ing.oil.sum += block.value[s_ing.oil.slot];
+            s_ing.oil.blocks++;
+        }
+        if (s_ing.fuel.slot >= 0) {
+            s_ing.fuel.sum += block.value[s_ing.fuel.slot];
+            s_ing.fuel.blocks++;
+        }
+    }
+
+    float v;
+    if (sender_avg_take(&s_ing.oil, OIL_DISPLAY_MS, now, &v)) {
+        gauge_data_set(g, GAUGE_OIL_PRESSURE,
+                       clampf((v - OIL_V_MIN) / OIL_V_SPAN * OIL_PSI_MAX, 0, OIL_PSI_MAX), now);
+        bool low = g->oil_pressure < LOW_OIL_PSI && g->engine_running;
+        if (low != g->low_oil_pressure) {
+            g->low_oil_pressure = low;
+            g->changed |= GAUGE_BIT(GAUGE_OIL_PRESSURE);
+        }
+    }
+    if (sender_avg_take(&s_ing.fuel, FUEL_DISPLAY_MS, now, &v)) {
+        float r = (v < ADC_FULL_SCALE_V) ?
+                  (FUEL_R_KNOWN * v) / (ADC_FULL_SCALE_V - v) : FUEL_R_FULL;
+        gauge_data_set(g, GAUGE_FUEL_LEVEL,
+                       clampf((r - FUEL_R_EMPTY) / (FUEL_R_FULL - FUEL_R_EMPTY) * 100.0f,
+                              0, 100.0f), now);
+    }
+}
+
+// Log signals going stale and coming back, one line per transition
+static void log_freshness(uint32_t stale, uint32_t fresh, uint32_t was_fresh, uint32_t now,
+                          const gauge_data_t *g)
+{
+    for (uint32_t m = stale; m; m &= m - 1) {
+        int i = __builtin_ctz(m);
+        ESP_LOGW(TAG, "%s stale (%" PRIu32 " ms, mean interval %.0f ms)", gauge_signal_name(i),
+                 now - g->rx_ms[i], g->interval_ms[i]);
+    }
+    for (uint32_t m = fresh & ~was_fresh; m; m &= m - 1) {
+        ESP_LOGI(TAG, "%s live", gauge_signal_name(__builtin_ctz(m)));
+    }
+}
+
+static void ingest_task(void *arg)
+{
+    can_ring_init(&s_ing.ring, s_ing.ring_slots, CAN_RING_SLOTS);
+    esp_err_t ret = can_setup();
+    if (ret == ESP_OK) {
+        ret = vss_setup();
+    }
+    if (ret == ESP_OK) {
+        ret = adc_setup();
+    }
+    s_ing.start_ret = ret;
+    xTaskNotifyGive(s_ing.starter);
+    if (ret != ESP_OK) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    gauge_data_t *g = &s_ing.work;
+    uint32_t last_stale_log = 0;
+    uint32_t last_print = 0;
+    uint32_t last_report = now_ms();
+    TickType_t wake = xTaskGetTickCount();
+    const TickType_t period = pdMS_TO_TICKS(s_ing.cfg.period_ms) ?: 1;
+
+    while (1) {
+        uint32_t was_fresh = g->fresh;
+        update_can(g);
+        // After the drain: every frame decoded is stamped no later than now
+        uint32_t now = now_ms();
+        check_can_overflow();
+        // Whole bus silent; single signals are covered by their freshness
+        if (now - g->last_update_ms >= CAN_STALE_MS && now - last_stale_log >= CAN_STALE_LOG_MS) {
+            ESP_LOGW(TAG, "CAN data stale (%" PRIu32 " ms)", now - g->last_update_ms);
+            last_stale_log = now;
+        }
+        update_vss(g, now);
+        update_analog(g, now);
+        uint32_t stale = gauge_data_expire(g, now);
+        if (stale || g->fresh != was_fresh) {
+            log_freshness(stale, g->fresh, was_fresh, now, g);
+        }
+
+        // Publish only when a value, warning or freshness changed; the
+        // renderer sleeps otherwise and then redraws just those signals
+        if (g->changed) {
+            g->publish_us = esp_timer_get_time();
+            gauge_snapshot_publish(&s_ing.snap, g);
+            g->changed = 0;
+            if (s_ing.cfg.on_publish) {
+                s_ing.cfg.on_publish(s_ing.cfg.user_ctx);
+            }
+        }
+
+        if (now - last_print >= DEBUG_PRINT_MS) {
+            ESP_LOGD(TAG, "RPM %.0f | Coolant %.0fF | Battery %.1fV | Speed %.0f MPH | "
+                     "Oil %.0f PSI | Fuel %.0f%%", g->rpm, g->coolant_temp,
+                     g->battery_voltage, g->speed, g->oil_pressure, g->fuel_level);
+            ESP_LOGD(TAG, "CAN %" PRIu32 " frames, ring high water %" PRIu32 "/%d, %" PRIu32
+                     " dropped", s_ing.can_frames, s_ing.ring.high_water, CAN_RING_SLOTS,
+                     s_ing.ring.overflows);
+            if (s_ing.cfg.vss_gpio >= 0) {
+                ESP_LOGD(TAG, "VSS %.1f MPH | count %.1f Hz, period %.1f Hz, blend %.2f | "
+                         "capture %s, %" PRIu32 " edges timed, %" PRId32 " pulses",
+                         s_ing.vss.mph, s_ing.vss.count_hz, s_ing.vss.period_hz, s_ing.vss.blend,
+                         s_ing.vss.capture_on ? "on" : "off", s_ing.vss.captures,
+                         s_ing.vss.pulses);
+            }
+            if (s_ing.oil.slot >= 0 || s_ing.fuel.slot >= 0) {
+                sender_adc_stats_t adc;
+                sender_adc_get_stats(&adc);
+                ESP_LOGD(TAG, "ADC %" PRIu32 " blocks, %" PRIu32 " DMA frames dropped, %" PRIu32
+                         " bad samples", adc.blocks, adc.dropped_frames, adc.bad_samples);
+            }
+            last_print = now;
+        }
+
+        if (now - last_report >= CAN_REPORT_MS) {
+            can_bus_report();
+            last_report = now;
+        }
+
+        vTaskDelayUntil(&wake, period);
+    }
+}
+
+esp_err_t gauge_ingest_start(const gauge_ingest_config_t *config)
+{
+    if (!config || config->core < 0 || config->core >= portNUM_PROCESSORS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_ing.cfg = *config;
+    s_ing.starter = xTaskGetCurrentTaskHandle();
+
+    if (xTaskCreatePinnedToCore(ingest_task, "ingest", INGEST_TASK_STACK, NULL,
+                                INGEST_TASK_PRIORITY, NULL, config->core) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if (s_ing.start_ret == ESP_OK) {
+        ESP_LOGI(TAG, "Ingestion on core %d, %" PRIu32 " ms period", config->core,
+                 config->period_ms);
+    }
+    return s_ing.start_ret;
+}
+
+gauge_snapshot_t *gauge_ingest_snapshot(void)
+{
+    return &s_ing.snap;
+}
+
+void gauge_ingest_get_stats(gauge_ingest_stats_t *out)
+{
+    out->can_frames = s_ing.can_frames;
+    out->ring_slots = CAN_RING_SLOTS;
+    out->ring_high_water = __atomic_load_n(&s_ing.ring.high_water, __ATOMIC_RELAXED);
+    out->ring_overflows = __atomic_load_n(&s_ing.ring.overflows, __ATOMIC_RELAXED);
+}
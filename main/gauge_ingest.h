@@ -0,0 +1,85 @@
+/**
+ * Gauge Data Ingestion
+ *
+ * One task, pinned to its own core, runs what the Arduino sketch's loop()
+ * did: feed received CAN frames to the Holley decoder, turn VSS
+ * pulses into road speed and read the oil pressure and fuel senders. The
+ * TWAI and VSS interrupts are installed from that task, so they land on
+ * the same core. Results go out through a gauge_snapshot_t, so the
+ * renderer on the other core never waits on ingestion and vice versa.
+ */
+
+#ifndef GAUGE_INGEST_H
+#define GAUGE_INGEST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "gauge_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Called after every publish, from the ingestion task
+ *
+ * Publishes only happen when a value, warning or freshness changed.
+ *
+ * Must not block (e.g. a task notification).
+ */
+typedef void (*gauge_ingest_notify_t)(void *user_ctx);
+
+/**
+ * @brief Ingestion configuration
+ */
+typedef struct {
+    gpio_num_t can_tx_gpio;     /*!< To the transceiver's TXD */
+    gpio_num_t can_rx_gpio;     /*!< From the transceiver's RXD */
+    gpio_num_t vss_gpio;        /*!< Hall VSS input, -1 if not wired */
+    gpio_num_t oil_gpio;        /*!< Oil pressure sender (ADC pin), -1 if not wired */
+    gpio_num_t fuel_gpio;       /*!< Fuel sender divider (ADC pin), -1 if not wired */
+    bool can_accept_all;        /*!< Receive every frame, not just the catalog's IDs */
+    size_t can_capture_bytes;   /*!< Stream received frames to the console for replay, 0 = off */
+    uint32_t period_ms;         /*!< Loop period */
+    int core;                   /*!< Core for the task and its interrupts */
+    gauge_ingest_notify_t on_publish;
+    void *user_ctx;
+} gauge_ingest_config_t;
+
+/**
+ * @brief CAN receive path counters
+ */
+typedef struct {
+    uint32_t can_frames;        /*!< Frames decoded */
+    uint32_t ring_slots;        /*!< Frame ring capacity */
+    uint32_t ring_high_water;   /*!< Most frames ever waiting for the decoder */
+    uint32_t ring_overflows;    /*!< Frames dropped on a full ring */
+} gauge_ingest_stats_t;
+
+/**
+ * @brief Start the ingestion task
+ *
+ * Returns once the TWAI driver, VSS input and ADC are set up on the
+ * ingestion core.
+ */
+esp_err_t gauge_ingest_start(const gauge_ingest_config_t *config);
+
+/**
+ * @brief Snapshot the ingestion task publishes to
+ *
+ * Not const: the renderer takes its changed bits with gauge_snapshot_take().
+ */
+gauge_snapshot_t *gauge_ingest_snapshot(void);
+
+/**
+ * @brief Read the CAN receive path counters (any task)
+ */
+void gauge_ingest_get_stats(gauge_ingest_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GAUGE_INGEST_H */
@@ -0,0 +1,148 @@
+/**
+ * Holley Sniper 2 CAN Decoding
+ *
+ * Table driven: the frame ID is looked up in a perfect hash generated from
+ * holley_signals.def, and the matching slot's run of operations decodes
+ * its signals and updates their warning flags. Adding a channel is a
+ * catalog line and a regenerate, not code.
+ */
+
+#include "holley_can.h"
+#include <stddef.h>
+#include <string.h>
+
+typedef enum {
+    HOLLEY_OP_U8,
+    HOLLEY_OP_S8,
+    HOLLEY_OP_U16,
+    HOLLEY_OP_S16,
+    HOLLEY_OP_U32,
+    HOLLEY_OP_S32,
+    HOLLEY_OP_WARN_GT,              // flag = field > k (and gate)
+    HOLLEY_OP_WARN_LT,              // flag = field < k (and gate)
+} holley_opcode_t;
+
+// Lookup slot: frame ID and its run in the program
+typedef struct {
+    uint32_t id;                    // CAN_EXT_ID_MASK + 1.. when empty
+    uint16_t first;
+    uint8_t count;
+} holley_slot_t;
+
+// One decode or warning step; field, flag and gate are gauge_data_t offsets
+typedef struct {
+    uint8_t op;                     // holley_opcode_t
+    uint8_t byte;                   // First data byte (decode)
+    uint8_t field;                  // float written (decode) or tested (warning)
+    uint8_t flag;                   // bool written (warning)
+    uint8_t gate;                   // bool that must also be set, or HOLLEY_GATE_NONE
+    float k;                        // Scale (decode) or threshold (warning)
+    float c;                        // Offset (decode)
+} holley_op_t;
+
+#define HOLLEY_GATE_NONE        0xFF
+
+// A decoded float's index is its gauge_signal_t (checked in gauge_data.c)
+#define SIGNAL_BIT(field_offset)    GAUGE_BIT((field_offset) / sizeof(float))
+
+#include "holley_can_gen.h"
+
+// The firmware build regenerates the table (main/CMakeLists.txt); these
+// catch a host build against a checked-in header whose signals, warnings or
+// IDs no longer match the catalog. Other field edits are not detected here.
+#define HOLLEY_SIGNAL(id, byte, width, sign, scale, offset, field)  + 1
+#define HOLLEY_WARN(field, flag, op, threshold, gate)
+_Static_assert(0
+#include "holley_signals.def"
+               == HOLLEY_GEN_SIGNALS, "holley_can_gen.h is stale");
+#undef HOLLEY_SIGNAL
+#define HOLLEY_SIGNAL(id, byte, width, sign, scale, offset, field)  + (uint64_t)HOLLEY_CAN_ID(id)
+_Static_assert(0ULL
+#include "holley_signals.def"
+               == HOLLEY_GEN_ID_SUM, "holley_can_gen.h is stale");
+#undef HOLLEY_SIGNAL
+#undef HOLLEY_WARN
+#define HOLLEY_SIGNAL(id, byte, width, sign, scale, offset, field)
+#define HOLLEY_WARN(field, flag, op, threshold, gate)  + 1
+_Static_assert(0
+#include "holley_signals.def"
+               == HOLLEY_GEN_WARNS, "holley_can_gen.h is stale");
+#undef HOLLEY_SIGNAL
+#undef HOLLEY_WARN
+
+static const uint8_t s_op_bytes[] = { 1, 1, 2, 2, 4, 4 };
+
+static inline const holley_slot_t *slot_lookup(uint32_t id)
+{
+    uint32_t bucket = (id * HOLLEY_HASH_M1) >> (32 - HOLLEY_HASH_BUCKET_BITS);
+    uint32_t slot = ((id * HOLLEY_HASH_M2) >> (32 - HOLLEY_HASH_SLOT_BITS)) ^ s_disp[bucket];
+    return &s_slots[slot];
+}
+
+// Little-endian raw value at p, sign-extended per op
+static inline float raw_value(const uint8_t *p, uint8_t op)
+{
+    switch (op) {
+    case HOLLEY_OP_U8:  return p[0];
+    case HOLLEY_OP_S8:  return (int8_t)p[0];
+    case HOLLEY_OP_U16: return (uint16_t)(p[0] | p[1] << 8);
+    case HOLLEY_OP_S16: return (int16_t)(p[0] | p[1] << 8);
+    case HOLLEY_OP_U32: return (uint32_t)(p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24);
+    default:            return (int32_t)(p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24);
+    }
+}
+
+size_t holley_can_frame_ids(const uint32_t **ids)
+{
+    *ids = s_frame_ids;
+    return HOLLEY_GEN_FRAMES;
+}
+
+bool holley_can_parse(const can_frame_t *frame, gauge_data_t *g, uint32_t now_ms)
+{
+    if (!frame->extd) {
+        return false;
+    }
+    g->last_update_ms = now_ms;
+
+    const holley_slot_t *slot = slot_lookup(frame->id);
+    if (slot->id != frame->id) {
+        return false;
+    }
+
+    // Signals decoded from this frame; a warning on a field a short frame
+    // didn't carry is left as it was. A warning flag that flips counts as
+    // a change of its field's signal.
+    uint32_t decoded = 0;
+    uint32_t changed = 0;
+    uint8_t *base = (uint8_t *)g;
+    const holley_op_t *op = &s_program[slot->first];
+    for (const holley_op_t *end = op + slot->count; op < end; op++) {
+        float *field = (float *)(base + op->field);
+        uint32_t field_bit = SIGNAL_BIT(op->field);
+        if (op->op >= HOLLEY_OP_WARN_GT) {
+            if (!(decoded & field_bit)) {
+                continue;
+            }
+            bool on = (op->op == HOLLEY_OP_WARN_GT) ? *field > op->k : *field < op->k;
+            if (op->gate != HOLLEY_GATE_NONE) {
+                on = on && *(const bool *)(base + op->gate);
+            }
+            bool *flag = (bool *)(base + op->flag);
+            if (*flag != on) {
+                *flag = on;
+                changed |= field_bit;
+            }
+        } else if (op->byte + s_op_bytes[op->op] <= frame->dlc) {
+            float v = raw_value(&frame->data[op->byte], op->op) * op->k + op->c;
+            if (memcmp(field, &v, sizeof(v)) != 0) {
+                *field = v;
+                changed |= field_bit;
+            }
+            decoded |= field_bit;
+        }
+    }
+    g->changed |= changed;
+    gauge_data_received(g, decoded, now_ms);
+    return true;
+}
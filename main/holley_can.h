@@ -0,0 +1,68 @@
+/**
+ * Holley Sniper 2 CAN Decoding
+ *
+ * The ECU broadcasts each channel in its own extended (29-bit) frame, the
+ * value as a little-endian int32 in bytes 0-3. Holley documents the IDs
+ * with bit 31 set (0x9E005000 for RPM); on the wire, and in
+ * twai_message_t::identifier, only the low 29 bits exist, so catalog IDs
+ * are masked accordingly. The channels decoded, their scaling and the
+ * warning thresholds are listed in holley_signals.def.
+ *
+ * Plain C so recorded frames can be decoded off-target.
+ */
+
+#ifndef HOLLEY_CAN_H
+#define HOLLEY_CAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "gauge_data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Valid bits of an extended CAN identifier */
+#define CAN_EXT_ID_MASK         0x1FFFFFFFu
+
+/** Holley's documented ID as it appears on the bus */
+#define HOLLEY_CAN_ID(doc_id)   ((uint32_t)(doc_id) & CAN_EXT_ID_MASK)
+
+/**
+ * @brief One received CAN frame, independent of the TWAI driver
+ */
+typedef struct {
+    uint32_t id;                /*!< 11- or 29-bit identifier */
+    bool extd;                  /*!< Extended (29-bit) frame */
+    uint8_t dlc;                /*!< Data length, 0-8 */
+    uint8_t data[8];
+    int64_t rx_us;              /*!< Receive time (esp_timer) */
+} can_frame_t;
+
+/**
+ * @brief Decode one frame into the gauge values
+ *
+ * Any extended frame refreshes last_update_ms, as a sign of a live ECU.
+ * Each decoded signal is stamped (gauge_data_received()) and, if its value
+ * or warning flag changed, marked in changed. Signals that don't fit in a
+ * short frame keep their previous value.
+ *
+ * @param now_ms Receive time in milliseconds
+ * @return true if the frame carried a known channel
+ */
+bool holley_can_parse(const can_frame_t *frame, gauge_data_t *gauges, uint32_t now_ms);
+
+/**
+ * @brief Frame IDs the catalog decodes: the set to receive
+ *
+ * @param[out] ids Sorted, unique 29-bit IDs
+ * @return Number of IDs
+ */
+size_t holley_can_frame_ids(const uint32_t **ids);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOLLEY_CAN_H */
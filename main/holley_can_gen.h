@@ -0,0 +1,54 @@
+// Generated by tools/holley_can_gen.py from holley_signals.def - do not edit
+// 8 signals in 8 frames, 3 warnings; 16-slot perfect hash
+// Included by holley_can.c only
+
+#define HOLLEY_GEN_SIGNALS      8
+#define HOLLEY_GEN_WARNS        3
+#define HOLLEY_GEN_FRAMES       8
+#define HOLLEY_GEN_ID_SUM       0xF03D0800ULL
+#define HOLLEY_HASH_M1          0x2265B1F5u
+#define HOLLEY_HASH_M2          0x91B7584Bu
+#define HOLLEY_HASH_BUCKET_BITS 3
+#define HOLLEY_HASH_SLOT_BITS   4
+
+static const uint32_t s_frame_ids[8] = {
+    0x1E005000, 0x1E019000, 0x1E059000, 0x1E05D000, 0x1E065800, 0x1E069000,
+    0x1E06D000, 0x1E1C1000,
+};
+
+static const uint16_t s_disp[8] = {
+    3, 0, 0, 0, 0, 0, 1, 0,
+};
+
+static const holley_slot_t s_slots[16] = {
+    { 0xFFFFFFFF, 0, 0 },
+    { 0x1E005000, 0, 2 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0x1E019000, 10, 1 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0x1E05D000, 8, 1 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0x1E059000, 7, 1 },
+    { 0xFFFFFFFF, 0, 0 },
+    { 0x1E069000, 2, 2 },
+    { 0x1E06D000, 4, 2 },
+    { 0x1E1C1000, 6, 1 },
+    { 0x1E065800, 9, 1 },
+};
+
+static const holley_op_t s_program[11] = {
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, rpm), 0, 0, 1.0f, 0.0f },   // 0x9E005000
+    { HOLLEY_OP_WARN_GT, 0, offsetof(gauge_data_t, rpm), offsetof(gauge_data_t, engine_running), HOLLEY_GATE_NONE, 200.0f, 0 },
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, coolant_temp), 0, 0, 1.0f, 0.0f },   // 0x9E069000
+    { HOLLEY_OP_WARN_GT, 0, offsetof(gauge_data_t, coolant_temp), offsetof(gauge_data_t, high_coolant_temp), HOLLEY_GATE_NONE, 220.0f, 0 },
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, battery_voltage), 0, 0, 1.0f, 0.0f },   // 0x9E06D000
+    { HOLLEY_OP_WARN_LT, 0, offsetof(gauge_data_t, battery_voltage), offsetof(gauge_data_t, low_battery), offsetof(gauge_data_t, engine_running), 12.5f, 0 },
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, speed), 0, 0, 1.0f, 0.0f },   // 0x9E1C1000
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, iac), 0, 0, 1.0f, 0.0f },   // 0x9E059000
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, map), 0, 0, 1.0f, 0.0f },   // 0x9E05D000
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, mat), 0, 0, 1.0f, 0.0f },   // 0x9E065800
+    { HOLLEY_OP_S32, 0, offsetof(gauge_data_t, afr), 0, 0, 1.0f, 0.0f },   // 0x9E019000
+};
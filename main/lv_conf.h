@@ -55,6 +55,13 @@
 /* Default display refresh period in milliseconds */
 #define LV_DISP_DEF_REFR_PERIOD 16  // ~60 FPS (was 50)
 
+/* Derive the tick from esp_timer instead of a 1 kHz lv_tick_inc() timer */
+#define LV_TICK_CUSTOM 1
+#if LV_TICK_CUSTOM
+  #define LV_TICK_CUSTOM_INCLUDE "esp_timer.h"
+  #define LV_TICK_CUSTOM_SYS_TIME_EXPR ((uint32_t)(esp_timer_get_time() / 1000))
+#endif
+
 /* Default input device read period in milliseconds */
 #define LV_INDEV_DEF_READ_PERIOD 30
 
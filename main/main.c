@@ -12,6 +12,7 @@
  * BL    -> GPIO4
  */
 
+#include <inttypes.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
@@ -20,8 +21,15 @@
 #include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "esp_attr.h"
+#include "hal/gpio_ll.h"
 #include "lvgl.h"
 #include "st77916_panel.h"
+#include "st77916_te.h"
+#include "boot_trace.h"
+#include "cluster_demo.h"
+#include "gauge_data.h"
+#include "gauge_ingest.h"
 #include "ui/ui.h"
 
 static const char *TAG = "ST77916_LVGL";
@@ -36,6 +44,7 @@ static const char *TAG = "ST77916_LVGL";
 #define PIN_NUM_IO2     10
 #define PIN_NUM_IO3     11
 #define PIN_NUM_BL      4
+#define PIN_NUM_TE      -1      // Panel TE output, -1 if not wired
 
 // Display resolution
 #define LCD_H_RES       360
@@ -47,52 +56,600 @@ static const char *TAG = "ST77916_LVGL";
 static lv_color_t draw_buf1[LCD_H_RES * DRAW_BUF_LINES];
 static lv_color_t draw_buf2[LCD_H_RES * DRAW_BUF_LINES];
 
+// Panel IO queue depth > 1 lets tile N+1 be queued while tile N is on the bus
+#define LCD_TRANS_QUEUE_DEPTH   4
+
+// Largest single QSPI transfer; tiles are streamed in chunks of this size
+#define LCD_MAX_TRANSFER_BYTES  (LCD_H_RES * 80 * sizeof(uint16_t))
+#define LCD_CHUNK_BYTES         (LCD_H_RES * 8 * sizeof(uint16_t))
+
+// Frames between pipeline timing reports
+#define FRAME_STATS_INTERVAL    60
+
+// Bus pixel format. RGB444 cuts pixel bytes by 25% at reduced color depth.
+#define LCD_PIXEL_FORMAT        ST77916_PIXEL_RGB565
+// Cycle through all pixel formats, one per timing report, to compare fps
+#define LCD_FORMAT_BENCH        0
+
+// Diff tiles against a PSRAM copy of the screen and send only changed spans
+#define LCD_SHADOW_FB           1
+
+// Bus path to the panel: esp_lcd panel IO or the driver's own spi_master device
+#define LCD_TRANSPORT           ST77916_TRANSPORT_PANEL_IO
+// At boot, time full-screen fills over both transports and log them side by side
+#define LCD_TRANSPORT_BENCH     0
+#define LCD_BENCH_FRAMES        30
+
+// TE-synced refresh: each frame is started by a TE edge instead of LVGL's
+// refresh timer. Without PIN_NUM_TE, a simulated TE of this period can be
+// used (0 = keep LVGL's free-running LV_DISP_DEF_REFR_PERIOD timer).
+#define LCD_TE_SIM_PERIOD_US    0
+// Refresh anyway if TE edges stop arriving
+#define LCD_TE_TIMEOUT_MS       100
+
+// Event-driven LVGL task: sleep until lv_timer_handler()'s next deadline or
+// a wake notification (TE edge, new data). 0 = poll every 5 ms.
+#define LVGL_EVENT_DRIVEN       1
+// Interval of the LVGL task wakeup / CPU load report
+#define LVGL_LOAD_REPORT_MS     5000
+
+// Simulated speed sweep feeding the meter (wakes LVGL every period); 0
+// leaves the gauges idle, where the load report should show ~0 wakeups/s
+#define SPEED_SIM               0
+#define SPEED_SIM_PERIOD_MS     30
+
+// Run the five-gauge cluster (display manager, shared-bus scheduler)
+// instead of the single-panel demo below
+#define LCD_CLUSTER             0
+
+// Live gauge data (Holley CAN, VSS, oil and fuel senders) instead of the
+// simulated sweep. Ingestion and its interrupts run on INGEST_CORE,
+// LVGL and the display bus interrupts on LVGL_CORE.
+#define GAUGE_INGEST            0
+#define INGEST_CORE             0
+#define LVGL_CORE               1
+#define INGEST_PERIOD_MS        10
+#define PIN_NUM_CAN_TX          41
+#define PIN_NUM_CAN_RX          42
+#define PIN_NUM_VSS             40
+#define PIN_NUM_OIL             1       // ADC1_CH0
+#define PIN_NUM_FUEL            2       // ADC1_CH1
+// Stream every received CAN frame to the console as "CAP" lines for
+// tools/can_replay.c (buffer size, power of two; 0 = off)
+#define CAN_CAPTURE_BYTES       0
+
+// Gauge snapshot contention/latency benchmark at boot (occupies both cores)
+#define GAUGE_SNAPSHOT_BENCH    0
+#define GAUGE_BENCH_MS          1000
+
+#if GAUGE_INGEST && SPEED_SIM
+#error "GAUGE_INGEST and SPEED_SIM both drive the meter; enable one"
+#endif
+
+// Reasons the LVGL task was woken (task notification bits)
+#define LVGL_WAKE_TE            (1u << 0)   // TE edge: render the next frame
+#define LVGL_WAKE_DATA          (1u << 1)   // New gauge values to show
+
 static esp_lcd_panel_io_handle_t g_io_handle = NULL;
+static st77916_panel_handle_t g_panel = NULL;
+static lv_disp_drv_t disp_drv;
+static TaskHandle_t s_lvgl_task = NULL;
+static bool s_te_sync = false;
+
+// Latest simulated speed, written by the producer, shown by the LVGL task
+static volatile int32_t s_speed = 0;
+
+// LVGL task wakeups and busy time since the last load report
+static struct {
+    uint32_t wakeups;
+    uint32_t te;
+    uint32_t data;
+    uint32_t timer;                 // lv_timer_handler() deadline or timeout
+    int64_t busy_us;
+    int64_t window_start_us;
+} s_lv_load;
+
+// Backlight turns on once both the panel is up (DISPON) and a picture is in
+// GRAM (the splash, or else LVGL's first frame), whichever comes last
+#define BOOT_GATES_FOR_BACKLIGHT    2
+static uint32_t s_boot_gates = 0;
+
+// F100 badge, RLE565 in flash (generated by tools/splash_rle565.py)
+extern const st77916_splash_t splash_f100;
+
+// Per-frame flush pipeline timing. A frame runs from the first flush_cb call
+// to the transfer-done of its last tile. "render" is time LVGL spent drawing
+// between flush_cb calls, "xfer" is bus time reported by the panel driver;
+// whatever their sum exceeds the frame time by is render/transfer overlap.
+static struct {
+    bool in_frame;
+    int64_t start_us;
+    int64_t last_ret_us;
+    int64_t render_us;
+    uint64_t xfer_base_us;
+    uint32_t submitted;             // Tiles handed to the driver
+    uint32_t done;                  // Tiles completed (ISR)
+    uint32_t last_seq;              // Sequence number of the frame's last tile
+    volatile int64_t end_us;        // Completion time of the last tile (ISR)
+
+    // Accumulated over FRAME_STATS_INTERVAL frames
+    uint32_t frames;
+    int64_t sum_frame_us;
+    int64_t sum_render_us;
+    int64_t sum_xfer_us;
+    int64_t report_us;                  // Time of the last report
+    st77916_panel_stats_t report_base;  // Driver counters at the last report
+} s_ft;
+
+static st77916_pixel_format_t s_pixel_format = LCD_PIXEL_FORMAT;
+static const char *const s_pixel_format_names[] = {
+    [ST77916_PIXEL_RGB565] = "RGB565",
+    [ST77916_PIXEL_RGB444] = "RGB444",
+    [ST77916_PIXEL_RGB666] = "RGB666",
+};
+
+static void frame_timing_close(void)
+{
+    if (s_ft.end_us <= s_ft.start_us) {
+        return;     // No completed frame to account
+    }
+
+    st77916_panel_stats_t st;
+    st77916_panel_get_stats(g_panel, &st);
+
+    s_ft.sum_frame_us  += s_ft.end_us - s_ft.start_us;
+    s_ft.sum_render_us += s_ft.render_us;
+    s_ft.sum_xfer_us   += (int64_t)(st.xfer_us - s_ft.xfer_base_us);
+
+    if (++s_ft.frames >= FRAME_STATS_INTERVAL) {
+        int64_t n = s_ft.frames;
+        int64_t frame_us  = s_ft.sum_frame_us / n;
+        int64_t render_us = s_ft.sum_render_us / n;
+        int64_t xfer_us   = s_ft.sum_xfer_us / n;
+        int64_t overlap_us = render_us + xfer_us - frame_us;
+        if (overlap_us < 0) overlap_us = 0;
+        int64_t now_us = esp_timer_get_time();
+        if (s_ft.report_us) {
+            int64_t fps_x10 = (n * 10000000) / (now_us - s_ft.report_us);
+            ESP_LOGI(TAG, "%s: %lld.%lld fps", s_pixel_format_names[s_pixel_format],
+                     fps_x10 / 10, fps_x10 % 10);
+        }
+        ESP_LOGI(TAG, "frame %lld us | render %lld us | xfer %lld us | overlap %lld us (%lld%%) | pool waits %lu",
+                 frame_us, render_us, xfer_us, overlap_us,
+                 xfer_us ? (overlap_us * 100) / xfer_us : 0,
+                 (unsigned long)st.pool_waits);
+        ESP_LOGI(TAG, "bytes/frame: sent %llu | outside glass skipped %llu | unchanged skipped %llu (%lu whole tiles)",
+                 (st.bytes_sent - s_ft.report_base.bytes_sent) / n,
+                 (st.clip_bytes_skipped - s_ft.report_base.clip_bytes_skipped) / n,
+                 (st.shadow_bytes_avoided - s_ft.report_base.shadow_bytes_avoided) / n,
+                 (unsigned long)(st.shadow_full_tiles - s_ft.report_base.shadow_full_tiles));
+        ESP_LOGI(TAG, "per frame: %lu transactions | %llu command bytes | %lu window cmds skipped",
+                 (unsigned long)((st.transactions - s_ft.report_base.transactions) / n),
+                 (st.cmd_bytes - s_ft.report_base.cmd_bytes) / n,
+                 (unsigned long)((st.window_cmds_skipped - s_ft.report_base.window_cmds_skipped) / n));
+        if (s_te_sync) {
+            st77916_te_stats_t te;
+            st77916_te_get_stats(&te);
+            ESP_LOGI(TAG, "TE: period %lu us (min %lu, max %lu) | frames %lu | missed scan window %lu",
+                     (unsigned long)te.period_us, (unsigned long)te.period_min_us,
+                     (unsigned long)te.period_max_us, (unsigned long)te.frames,
+                     (unsigned long)te.missed);
+        }
+        s_ft.report_base = st;
+        s_ft.report_us = now_us;
+        s_ft.frames = 0;
+        s_ft.sum_frame_us = s_ft.sum_render_us = s_ft.sum_xfer_us = 0;
+
+#if LCD_FORMAT_BENCH
+        // Called before the next frame's first tile, so no tile mixes formats
+        st77916_pixel_format_t next = (s_pixel_format + 1) % 3;
+        if (st77916_panel_set_pixel_format(g_panel, next) == ESP_OK) {
+            s_pixel_format = next;
+        }
+#endif
+    }
+}
+
+// Pass one backlight gate; the last one switches the backlight on. Called
+// from the bring-up task and the flush-done ISR, hence the register write.
+static void IRAM_ATTR boot_gate_pass(void)
+{
+    if (__atomic_add_fetch(&s_boot_gates, 1, __ATOMIC_ACQ_REL) == BOOT_GATES_FOR_BACKLIGHT) {
+        gpio_ll_set_level(GPIO_LL_GET_HW(GPIO_PORT_0), PIN_NUM_BL, 1);
+        boot_trace_mark(BOOT_BACKLIGHT_ON);
+    }
+}
+
+// Panel bring-up progress (bring-up task)
+static void lcd_bringup_cb(st77916_bringup_phase_t phase, void *user_ctx)
+{
+    switch (phase) {
+    case ST77916_BRINGUP_RESET:       boot_trace_mark(BOOT_PANEL_RESET); break;
+    case ST77916_BRINGUP_INIT_CMDS:   boot_trace_mark(BOOT_PANEL_INIT_CMDS); break;
+    case ST77916_BRINGUP_SLEEP_OUT:   boot_trace_mark(BOOT_PANEL_SLEEP_OUT); break;
+    case ST77916_BRINGUP_SPLASH:
+        boot_trace_mark(BOOT_PANEL_SPLASH);
+        boot_gate_pass();
+        break;
+    case ST77916_BRINGUP_FIRST_FRAME: boot_trace_mark(BOOT_PANEL_FIRST_FRAME); break;
+    case ST77916_BRINGUP_READY:
+        boot_trace_mark(BOOT_PANEL_READY);
+        boot_gate_pass();
+        break;
+    case ST77916_BRINGUP_FAILED:
+        ESP_LOGE(TAG, "Panel bring-up failed, backlight stays off");
+        break;
+    }
+}
+
+// Panel transfer-done callback (ISR): hand the draw buffer back to LVGL
+static void IRAM_ATTR lvgl_flush_done_cb(void *user_ctx)
+{
+    if (++s_ft.done == s_ft.last_seq) {
+        s_ft.end_us = esp_timer_get_time();
+        st77916_te_frame_end(s_ft.end_us);
+        if (!boot_trace_marked(BOOT_FIRST_FRAME_DONE)) {
+            boot_trace_mark(BOOT_FIRST_FRAME_DONE);
+            // The splash is decided under the driver's bring-up lock, before
+            // any tile of this frame could be accepted
+            if (!boot_trace_marked(BOOT_PANEL_SPLASH)) {
+                boot_gate_pass();
+            }
+        }
+    }
+    lv_disp_flush_ready((lv_disp_drv_t *)user_ctx);
+}
+
+// LVGL rounder: shrink invalidated areas to the visible part of the round
+// glass so corner pixels are never rendered
+static void lvgl_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area)
+{
+    int x_start = area->x1;
+    int y_start = area->y1;
+    int x_end   = area->x2 + 1;
+    int y_end   = area->y2 + 1;
 
-// LVGL flush callback — sends rendered tile to the display
+    if (!st77916_panel_visible_area(g_panel, &x_start, &y_start, &x_end, &y_end)) {
+        // The rounder cannot drop an area; keep a single (clipped) pixel
+        area->x2 = area->x1;
+        area->y2 = area->y1;
+        return;
+    }
+    area->x1 = x_start;
+    area->y1 = y_start;
+    area->x2 = x_end - 1;
+    area->y2 = y_end - 1;
+}
+
+// LVGL flush callback — queues rendered tile; completion is reported by
+// lvgl_flush_done_cb() so LVGL can render the next tile meanwhile
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
 {
-    st77916_panel_draw_bitmap(g_io_handle,
-                              area->x1, area->y1,
-                              area->x2 + 1, area->y2 + 1,
-                              color_p);
-    lv_disp_flush_ready(drv);
+    int64_t now = esp_timer_get_time();
+
+    if (!s_ft.in_frame) {
+        // LVGL waited for the previous frame's last flush before getting here
+        frame_timing_close();
+        st77916_panel_stats_t st;
+        st77916_panel_get_stats(g_panel, &st);
+        s_ft.in_frame = true;
+        s_ft.start_us = now;
+        s_ft.render_us = 0;
+        s_ft.xfer_base_us = st.xfer_us;
+        st77916_te_frame_begin(now);
+        st77916_panel_frame_begin(g_panel);
+    } else {
+        s_ft.render_us += now - s_ft.last_ret_us;
+    }
+
+    uint32_t seq = ++s_ft.submitted;
+    bool last = lv_disp_flush_is_last(drv);
+    if (last) {
+        s_ft.last_seq = seq;
+        s_ft.in_frame = false;
+    }
+
+    esp_err_t ret = st77916_panel_draw_bitmap(g_panel,
+                                              area->x1, area->y1,
+                                              area->x2 + 1, area->y2 + 1,
+                                              color_p);
+    if (ret != ESP_OK) {
+        // Driver reports no completion for a failed tile
+        lvgl_flush_done_cb(drv);
+    }
+    if (last) {
+        st77916_panel_frame_end(g_panel);
+    }
+
+    s_ft.last_ret_us = esp_timer_get_time();
+}
+
+// Wake the LVGL task with the given LVGL_WAKE_* reasons (task or ISR)
+static void IRAM_ATTR lvgl_wake(uint32_t reasons)
+{
+    if (xPortInIsrContext()) {
+        BaseType_t woken = pdFALSE;
+        xTaskNotifyFromISR(s_lvgl_task, reasons, eSetBits, &woken);
+        portYIELD_FROM_ISR(woken);
+    } else {
+        xTaskNotify(s_lvgl_task, reasons, eSetBits);
+    }
 }
 
+// TE edge (GPIO ISR or simulated timer): start the next frame
+static void IRAM_ATTR te_notify_cb(void *user_ctx)
+{
+    lvgl_wake(LVGL_WAKE_TE);
+}
+
+#if SPEED_SIM
+// Speed producer (esp_timer task): sweep 0..100..0 and wake the LVGL task
+static void speed_sim_cb(void *arg)
+{
+    static int32_t dir = 1;
+    int32_t speed = s_speed + dir;
+    if (speed >= 100) dir = -1;
+    if (speed <= 0)   dir =  1;
+    s_speed = speed;
+    lvgl_wake(LVGL_WAKE_DATA);
+}
+#endif
+
+#if GAUGE_INGEST
+// Ingestion published changed values (ingestion task)
+static void gauge_publish_cb(void *user_ctx)
+{
+    lvgl_wake(LVGL_WAKE_DATA);
+}
+
+#if LCD_CLUSTER
+static void cluster_publish_cb(void *user_ctx)
+{
+    cluster_demo_notify();
+}
+#endif
+
+static void gauge_ingest_begin(gauge_ingest_notify_t on_publish)
+{
+    const gauge_ingest_config_t ingest_config = {
+        .can_tx_gpio       = PIN_NUM_CAN_TX,
+        .can_rx_gpio       = PIN_NUM_CAN_RX,
+        .vss_gpio          = PIN_NUM_VSS,
+        .oil_gpio          = PIN_NUM_OIL,
+        .fuel_gpio         = PIN_NUM_FUEL,
+        .can_capture_bytes = CAN_CAPTURE_BYTES,
+        .period_ms         = INGEST_PERIOD_MS,
+        .core              = INGEST_CORE,
+        .on_publish        = on_publish,
+    };
+    ESP_ERROR_CHECK(gauge_ingest_start(&ingest_config));
+}
+#endif
+
+#if GAUGE_SNAPSHOT_BENCH
+// Writer on the ingestion core, reader on the LVGL core: back to back
+// (worst case contention), then at 1 kHz (10x the real publish rate)
+static void gauge_snapshot_bench_run(void)
+{
+    static const uint32_t periods_us[] = { 0, 1000 };
+    ESP_LOGI(TAG, "Snapshot bench: writer core %d, reader core %d, %d ms per run",
+             INGEST_CORE, LVGL_CORE, GAUGE_BENCH_MS);
+    ESP_LOGI(TAG, "%-8s %9s %9s %8s %6s %5s %10s %10s %9s %9s", "period",
+             "publishes", "reads", "retries", "maxrt", "torn", "rd cyc avg", "rd cyc max",
+             "age avg", "age max");
+    for (size_t i = 0; i < sizeof(periods_us) / sizeof(periods_us[0]); i++) {
+        gauge_snapshot_bench_t r;
+        ESP_ERROR_CHECK(gauge_snapshot_bench(INGEST_CORE, periods_us[i], GAUGE_BENCH_MS, &r));
+        ESP_LOGI(TAG, "%5" PRIu32 " us %9" PRIu32 " %9" PRIu32 " %8" PRIu32 " %6" PRIu32
+                 " %5" PRIu32 " %10" PRIu32 " %10" PRIu32 " %6" PRIu32 " us %6" PRIu32 " us",
+                 periods_us[i], r.publishes, r.reads, r.retries, r.max_retries, r.torn,
+                 r.read_cycles_avg, r.read_cycles_max, r.age_us_avg, r.age_us_max);
+        ESP_LOGI(TAG, "         publish worst case %" PRIu32 " cycles", r.publish_cycles_max);
+        if (r.torn) {
+            ESP_LOGE(TAG, "Snapshot returned %" PRIu32 " torn copies", r.torn);
+        }
+    }
+}
+#endif
+
+// Create the esp_lcd QSPI panel IO (32-bit opcode+command, quad pixel data)
+static esp_lcd_panel_io_handle_t lcd_new_panel_io(void)
+{
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+    esp_lcd_panel_io_spi_config_t io_config = {
+        .cs_gpio_num       = PIN_NUM_CS,
+        .dc_gpio_num       = -1,
+        .spi_mode          = 3,
+        .pclk_hz           = LCD_PIXEL_CLK,
+        .trans_queue_depth = LCD_TRANS_QUEUE_DEPTH,
+        .lcd_cmd_bits      = 32,
+        .lcd_param_bits    = 8,
+        .flags             = { .quad_mode = true },
+    };
+    ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST, &io_config, &io_handle));
+    return io_handle;
+}
+
+#if LCD_TRANSPORT_BENCH
+// Move the panel to another transport. The panel IO and the direct device
+// share PIN_NUM_CS, so the old one is gone before the new one is created.
+static void lcd_set_transport(st77916_transport_t transport)
+{
+    ESP_ERROR_CHECK(st77916_panel_set_transport(g_panel, NULL, ST77916_TRANSPORT_NONE));
+    if (g_io_handle) {
+        ESP_ERROR_CHECK(esp_lcd_panel_io_del(g_io_handle));
+        g_io_handle = NULL;
+    }
+    if (transport == ST77916_TRANSPORT_PANEL_IO) {
+        g_io_handle = lcd_new_panel_io();
+    }
+    ESP_ERROR_CHECK(st77916_panel_set_transport(g_panel, g_io_handle, transport));
+}
+
+// Time full-screen fills over each transport, then return to LCD_TRANSPORT
+static void lcd_transport_bench(void)
+{
+    static const char *const names[] = {
+        [ST77916_TRANSPORT_PANEL_IO]   = "panel IO",
+        [ST77916_TRANSPORT_DIRECT_SPI] = "direct SPI",
+    };
+    st77916_bench_t res[2];
+
+    // Color bars, so a broken transport is also visible on the glass
+    for (int i = 0; i < LCD_H_RES * DRAW_BUF_LINES; i++) {
+        draw_buf1[i].full = (i % LCD_H_RES < LCD_H_RES / 2) ? 0xF800 : 0x001F;
+    }
+
+    for (int t = ST77916_TRANSPORT_PANEL_IO; t <= ST77916_TRANSPORT_DIRECT_SPI; t++) {
+        lcd_set_transport(t);
+        ESP_ERROR_CHECK(st77916_panel_benchmark(g_panel, draw_buf1, DRAW_BUF_LINES,
+                                                LCD_BENCH_FRAMES, &res[t]));
+    }
+    lcd_set_transport(LCD_TRANSPORT);
+
+    ESP_LOGI(TAG, "transport   | frame us | fps  | MB/s");
+    for (int t = ST77916_TRANSPORT_PANEL_IO; t <= ST77916_TRANSPORT_DIRECT_SPI; t++) {
+        int64_t us = res[t].elapsed_us > 0 ? res[t].elapsed_us : 1;
+        ESP_LOGI(TAG, "%-11s | %8lld | %4lld | %lld.%02lld", names[t],
+                 us / res[t].frames, (int64_t)res[t].frames * 1000000 / us,
+                 (int64_t)res[t].bytes / us, ((int64_t)res[t].bytes * 100 / us) % 100);
+    }
+}
+#endif
+
+#if !LV_TICK_CUSTOM
 // esp_timer ISR: advance LVGL's internal clock every 1 ms
 static void lvgl_tick_cb(void *arg)
 {
     lv_tick_inc(1);
 }
+#endif
+
+// Log how often the LVGL task woke up and how much of the time it was busy
+static void lvgl_load_report(int64_t now_us)
+{
+    int64_t window_us = now_us - s_lv_load.window_start_us;
+    if (window_us < LVGL_LOAD_REPORT_MS * 1000LL) {
+        return;
+    }
+    uint32_t busy_x10 = (uint32_t)((s_lv_load.busy_us * 1000) / window_us);
+    ESP_LOGI(TAG, "lvgl: %lu wakeups/s (data %lu, te %lu, timer %lu) | busy %lu.%lu%%",
+             (unsigned long)((s_lv_load.wakeups * 1000000LL) / window_us),
+             (unsigned long)s_lv_load.data, (unsigned long)s_lv_load.te,
+             (unsigned long)s_lv_load.timer,
+             (unsigned long)(busy_x10 / 10), (unsigned long)(busy_x10 % 10));
+    s_lv_load.wakeups = s_lv_load.te = s_lv_load.data = s_lv_load.timer = 0;
+    s_lv_load.busy_us = 0;
+    s_lv_load.window_start_us = now_us;
+}
+
+// Ticks to sleep for an lv_timer_handler() delay, rounded up so the task
+// never wakes before the deadline
+static TickType_t lvgl_sleep_ticks(uint32_t wait_ms)
+{
+    TickType_t ticks = (wait_ms == LV_NO_TIMER_READY)
+                       ? portMAX_DELAY
+                       : (wait_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    if (s_te_sync && ticks > pdMS_TO_TICKS(LCD_TE_TIMEOUT_MS)) {
+        ticks = pdMS_TO_TICKS(LCD_TE_TIMEOUT_MS);
+    }
+    return ticks;
+}
 
 // Single task owns all LVGL calls (thread-safety requirement)
 static void lvgl_main_task(void *arg)
 {
+    // Runs while the panel is still in reset/sleep-out: the first frame
+    // lands in the shadow framebuffer and is shown right after DISPON, or
+    // replaces the splash if the UI was not ready by then
     ui_init();
+    boot_trace_mark(BOOT_UI_BUILT);
+    lv_refr_now(NULL);
+    boot_trace_mark(BOOT_FIRST_RENDER);
+    bool boot_dumped = false;
 
-    int32_t speed = 0;
-    int32_t dir   = 1;
-    uint32_t last_speed_ms = 0;
+    lv_disp_t *disp = lv_disp_get_default();
+    uint32_t wait_ms = 0;
+    int64_t last_refr_us = 0;
+    s_lv_load.window_start_us = esp_timer_get_time();
 
     while (1) {
-        lv_timer_handler();
-
-        // Advance simulated speed at ~30 ms intervals
-        uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
-        if ((now_ms - last_speed_ms) >= 30) {
-            last_speed_ms = now_ms;
-            ui_set_meter_value(speed);
-            speed += dir;
-            if (speed >= 100) dir = -1;
-            if (speed <= 0)   dir =  1;
+        uint32_t reasons = 0;
+#if LVGL_EVENT_DRIVEN
+        xTaskNotifyWait(0, UINT32_MAX, &reasons, lvgl_sleep_ticks(wait_ms));
+#else
+        if (s_te_sync) {
+            xTaskNotifyWait(0, UINT32_MAX, &reasons, pdMS_TO_TICKS(LCD_TE_TIMEOUT_MS));
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(5));
+            xTaskNotifyWait(0, UINT32_MAX, &reasons, 0);
+        }
+#endif
+        int64_t now_us = esp_timer_get_time();
+        s_lv_load.wakeups++;
+        if (!reasons) {
+            s_lv_load.timer++;
         }
 
-        vTaskDelay(pdMS_TO_TICKS(5));
+        if (reasons & LVGL_WAKE_DATA) {
+            s_lv_load.data++;
+            // The refresh timer is paused while idle; the change needs it
+            if (disp->refr_timer) {
+                lv_timer_resume(disp->refr_timer);
+            }
+#if GAUGE_INGEST
+            gauge_data_t gauges;
+            if (gauge_snapshot_take(gauge_ingest_snapshot(), &gauges) & GAUGE_BIT(GAUGE_SPEED)) {
+                ui_set_meter_value((int32_t)gauges.speed);
+            }
+#else
+            ui_set_meter_value(s_speed);
+#endif
+        }
+        if (reasons & LVGL_WAKE_TE) {
+            s_lv_load.te++;
+        }
+        if (s_te_sync && ((reasons & LVGL_WAKE_TE) ||
+                          now_us - last_refr_us >= LCD_TE_TIMEOUT_MS * 1000LL)) {
+            // Render right behind the scan so the transfer trails it
+            _lv_disp_refr_timer(NULL);
+            last_refr_us = now_us;
+        }
+
+        wait_ms = lv_timer_handler();
+
+        // Nothing left to draw and nothing animating: stop the refresh
+        // timer so an idle screen costs no wakeups
+        if (disp->refr_timer && disp->inv_p == 0 && lv_anim_count_running() == 0) {
+            lv_timer_pause(disp->refr_timer);
+        }
+
+        if (!boot_dumped && boot_trace_marked(BOOT_BACKLIGHT_ON)) {
+            boot_dumped = true;
+            boot_trace_dump();
+        }
+
+        int64_t end_us = esp_timer_get_time();
+        s_lv_load.busy_us += end_us - now_us;
+        lvgl_load_report(end_us);
     }
 }
 
 void app_main(void)
 {
+    boot_trace_mark(BOOT_APP_START);
+#if GAUGE_SNAPSHOT_BENCH
+    gauge_snapshot_bench_run();
+#endif
+#if LCD_CLUSTER
+#if GAUGE_INGEST
+    cluster_demo_start(LVGL_CORE, gauge_ingest_snapshot());
+    gauge_ingest_begin(cluster_publish_cb);
+#else
+    cluster_demo_start(LVGL_CORE, NULL);
+#endif
+    return;
+#endif
     ESP_LOGI(TAG, "ST77916 LVGL Meter Demo");
 
     // Backlight GPIO
@@ -114,29 +671,46 @@ void app_main(void)
         .data5_io_num = -1,
         .data6_io_num = -1,
         .data7_io_num = -1,
-        .max_transfer_sz = LCD_H_RES * 80 * sizeof(uint16_t),
+        .max_transfer_sz = LCD_MAX_TRANSFER_BYTES,
         .flags = SPICOMMON_BUSFLAG_MASTER,
+        // Transfer-done interrupts on the rendering core, away from CAN/VSS
+        .isr_cpu_id = (LVGL_CORE == 0) ? ESP_INTR_CPU_AFFINITY_0 : ESP_INTR_CPU_AFFINITY_1,
     };
     ESP_ERROR_CHECK(spi_bus_initialize(LCD_HOST, &bus_config, SPI_DMA_CH_AUTO));
+    boot_trace_mark(BOOT_BUS_READY);
 
-    // Create QSPI panel IO handle
-    esp_lcd_panel_io_handle_t io_handle = NULL;
-    esp_lcd_panel_io_spi_config_t io_config = {
-        .cs_gpio_num       = PIN_NUM_CS,
-        .dc_gpio_num       = -1,
-        .spi_mode          = 3,
-        .pclk_hz           = LCD_PIXEL_CLK,
-        .trans_queue_depth = 1,
-        .lcd_cmd_bits      = 32,
-        .lcd_param_bits    = 8,
-        .flags             = { .quad_mode = true },
-    };
-    ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST, &io_config, &io_handle));
-    g_io_handle = io_handle;
+    // Create QSPI panel IO handle (the direct transport adds its own device)
+    if (LCD_TRANSPORT == ST77916_TRANSPORT_PANEL_IO) {
+        g_io_handle = lcd_new_panel_io();
+    }
 
-    // Initialize ST77916 panel
-    ESP_ERROR_CHECK(st77916_panel_init(io_handle, PIN_NUM_RST));
-    gpio_set_level(PIN_NUM_BL, 1);
+    // Initialize ST77916 panel (ping-pong staging buffers of one chunk each).
+    // Reset and the init sequence run on the driver's own task meanwhile.
+    const st77916_panel_config_t panel_config = {
+        .rst_gpio        = PIN_NUM_RST,
+        .max_tile_pixels = LCD_H_RES * DRAW_BUF_LINES,
+        .pool_bufs       = 2,
+        .chunk_bytes     = LCD_CHUNK_BYTES,
+        .h_res           = LCD_H_RES,
+        .v_res           = LCD_V_RES,
+        .round_clip      = true,
+        .pixel_format    = LCD_PIXEL_FORMAT,
+        .shadow_fb       = LCD_SHADOW_FB,
+        .on_flush_done   = lvgl_flush_done_cb,
+        .user_ctx        = &disp_drv,
+        .transport       = LCD_TRANSPORT,
+        .spi_host        = LCD_HOST,
+        .cs_gpio         = PIN_NUM_CS,
+        .pclk_hz         = LCD_PIXEL_CLK,
+        .async_init      = true,
+        .on_bringup      = lcd_bringup_cb,
+        .splash          = &splash_f100,
+    };
+    ESP_ERROR_CHECK(st77916_panel_new(g_io_handle, &panel_config, &g_panel));
+#if LCD_TRANSPORT_BENCH
+    ESP_ERROR_CHECK(st77916_panel_wait_ready(g_panel, portMAX_DELAY));
+    lcd_transport_bench();
+#endif
 
     // Initialize LVGL
     lv_init();
@@ -145,14 +719,16 @@ void app_main(void)
     static lv_disp_draw_buf_t draw_buf_dsc;
     lv_disp_draw_buf_init(&draw_buf_dsc, draw_buf1, draw_buf2, LCD_H_RES * DRAW_BUF_LINES);
 
-    static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res  = LCD_H_RES;
     disp_drv.ver_res  = LCD_V_RES;
     disp_drv.flush_cb = lvgl_flush_cb;
+    disp_drv.rounder_cb = lvgl_rounder_cb;
     disp_drv.draw_buf = &draw_buf_dsc;
-    lv_disp_drv_register(&disp_drv);
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    boot_trace_mark(BOOT_LVGL_READY);
 
+#if !LV_TICK_CUSTOM
     // Start 1 ms periodic timer to drive lv_tick_inc()
     const esp_timer_create_args_t tick_timer_args = {
         .callback = lvgl_tick_cb,
@@ -161,7 +737,37 @@ void app_main(void)
     esp_timer_handle_t tick_timer;
     ESP_ERROR_CHECK(esp_timer_create(&tick_timer_args, &tick_timer));
     ESP_ERROR_CHECK(esp_timer_start_periodic(tick_timer, 1000));  // 1000 us = 1 ms
+#endif
+
+    // TE-synced refresh replaces LVGL's refresh timer; the task refreshes
+    // the display on each edge instead
+    s_te_sync = (PIN_NUM_TE >= 0) || (LCD_TE_SIM_PERIOD_US > 0);
+    if (s_te_sync) {
+        lv_timer_del(disp->refr_timer);
+        disp->refr_timer = NULL;
+    }
+
+    // Launch the LVGL task; producers wake it when they have new values
+    xTaskCreatePinnedToCore(lvgl_main_task, "lvgl_main", 8192, NULL, 5, &s_lvgl_task,
+                            LVGL_CORE);
 
-    // Launch combined LVGL handler + speed simulation task
-    xTaskCreate(lvgl_main_task, "lvgl_main", 8192, NULL, 5, NULL);
+#if GAUGE_INGEST
+    gauge_ingest_begin(gauge_publish_cb);
+#endif
+
+#if SPEED_SIM
+    const esp_timer_create_args_t speed_timer_args = {
+        .callback = speed_sim_cb,
+        .name     = "speed_sim",
+    };
+    esp_timer_handle_t speed_timer;
+    ESP_ERROR_CHECK(esp_timer_create(&speed_timer_args, &speed_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(speed_timer, SPEED_SIM_PERIOD_MS * 1000));
+#endif
+
+    if (PIN_NUM_TE >= 0) {
+        ESP_ERROR_CHECK(st77916_te_start_gpio(PIN_NUM_TE, te_notify_cb, NULL));
+    } else if (LCD_TE_SIM_PERIOD_US > 0) {
+        ESP_ERROR_CHECK(st77916_te_start_sim(LCD_TE_SIM_PERIOD_US, te_notify_cb, NULL));
+    }
 }
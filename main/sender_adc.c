@@ -0,0 +1,176 @@
+/**
+ * Analog Sender Sampling
+ *
+ * Decimation runs in sender_adc_read(), on the caller's task, not in the
+ * DMA callback: the driver copies every frame into its pool anyway, and
+ * reads of that pool can end mid-frame, so samples go to per-channel
+ * accumulators in whatever runs they arrive in. A block is complete once
+ * every channel has SENDER_ADC_BLOCK_SAMPLES; a channel that gets there
+ * first waits for the others, its samples in the meantime discarded and
+ * counted as bad.
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_adc/adc_continuous.h"
+#include "soc/soc_caps.h"
+#include "sender_adc.h"
+
+static const char *TAG = "sender_adc";
+
+#define FRAME_BYTES_MAX     (SENDER_ADC_BLOCK_SAMPLES * SENDER_ADC_MAX_CHANNELS * \
+                             SOC_ADC_DIGI_RESULT_BYTES)
+// Channel field of a TYPE2 result
+#define ADC_CHANNEL_SLOTS   16
+
+static struct {
+    adc_continuous_handle_t adc;
+    size_t num_channels;
+    uint32_t frame_bytes;
+    uint8_t slot_of[ADC_CHANNEL_SLOTS];     // ADC channel -> block slot + 1, 0 = not ours
+
+    // Frame being decimated
+    uint8_t buf[FRAME_BYTES_MAX];
+    uint32_t buf_len;
+    uint32_t buf_pos;
+
+    // Per-channel accumulators and the block they fill
+    uint32_t sum[SENDER_ADC_MAX_CHANNELS];
+    uint16_t count[SENDER_ADC_MAX_CHANNELS];
+    uint32_t done;                          // Slots complete in pending
+    sender_adc_block_t pending;
+
+    sender_adc_stats_t stats;
+} s_adc;
+
+static bool IRAM_ATTR pool_overflow_isr(adc_continuous_handle_t handle,
+                                        const adc_continuous_evt_data_t *edata, void *arg)
+{
+    __atomic_store_n(&s_adc.stats.dropped_frames, s_adc.stats.dropped_frames + 1,
+                     __ATOMIC_RELAXED);
+    return false;
+}
+
+static esp_err_t configure(const sender_adc_config_t *config)
+{
+    adc_digi_pattern_config_t pattern[SENDER_ADC_MAX_CHANNELS] = {0};
+    for (size_t i = 0; i < config->num_channels; i++) {
+        adc_unit_t unit;
+        adc_channel_t chan;
+        // ADC1 only: ADC2 is shared with Wi-Fi
+        if (adc_continuous_io_to_channel(config->gpios[i], &unit, &chan) != ESP_OK ||
+            unit != ADC_UNIT_1 || chan >= ADC_CHANNEL_SLOTS || s_adc.slot_of[chan]) {
+            ESP_LOGE(TAG, "GPIO%d is not a free ADC1 pin", config->gpios[i]);
+            return ESP_ERR_INVALID_ARG;
+        }
+        s_adc.slot_of[chan] = (uint8_t)(i + 1);
+        pattern[i].atten = ADC_ATTEN_DB_12;
+        pattern[i].channel = chan;
+        pattern[i].unit = ADC_UNIT_1;
+        pattern[i].bit_width = SENDER_ADC_RAW_BITS;
+    }
+    const adc_continuous_config_t adc_config = {
+        .pattern_num    = config->num_channels,
+        .adc_pattern    = pattern,
+        .sample_freq_hz = config->sample_hz * config->num_channels,
+        .conv_mode      = ADC_CONV_SINGLE_UNIT_1,
+        .format         = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+    };
+    const adc_continuous_evt_cbs_t cbs = {
+        .on_pool_ovf = pool_overflow_isr,
+    };
+    esp_err_t ret;
+    if ((ret = adc_continuous_config(s_adc.adc, &adc_config)) != ESP_OK ||
+        (ret = adc_continuous_register_event_callbacks(s_adc.adc, &cbs, NULL)) != ESP_OK) {
+        return ret;
+    }
+    return adc_continuous_start(s_adc.adc);
+}
+
+esp_err_t sender_adc_start(const sender_adc_config_t *config)
+{
+    if (!config || !config->gpios || config->num_channels == 0 ||
+        config->num_channels > SENDER_ADC_MAX_CHANNELS || config->sample_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_adc.adc) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // One DMA frame carries one block for every channel
+    s_adc.num_channels = config->num_channels;
+    s_adc.frame_bytes = SENDER_ADC_BLOCK_SAMPLES * config->num_channels * SOC_ADC_DIGI_RESULT_BYTES;
+    const adc_continuous_handle_cfg_t handle_config = {
+        .max_store_buf_size = s_adc.frame_bytes * SENDER_ADC_POOL_FRAMES,
+        .conv_frame_size    = s_adc.frame_bytes,
+    };
+    esp_err_t ret = adc_continuous_new_handle(&handle_config, &s_adc.adc);
+    if (ret == ESP_OK && (ret = configure(config)) != ESP_OK) {
+        adc_continuous_deinit(s_adc.adc);
+        s_adc.adc = NULL;
+        memset(s_adc.slot_of, 0, sizeof(s_adc.slot_of));
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Continuous ADC setup failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGI(TAG, "%u channels at %" PRIu32 " Hz, %d-sample blocks (%.1f ms, %d bits)",
+             (unsigned)config->num_channels, config->sample_hz, SENDER_ADC_BLOCK_SAMPLES,
+             SENDER_ADC_BLOCK_SAMPLES * 1000.0f / config->sample_hz, SENDER_ADC_RESULT_BITS);
+    return ESP_OK;
+}
+
+esp_err_t sender_adc_read(sender_adc_block_t *out)
+{
+    if (!s_adc.adc) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const uint32_t all = (1u << s_adc.num_channels) - 1;
+    while (1) {
+        while (s_adc.buf_pos < s_adc.buf_len) {
+            const adc_digi_output_data_t *d = (const void *)&s_adc.buf[s_adc.buf_pos];
+            s_adc.buf_pos += SOC_ADC_DIGI_RESULT_BYTES;
+            uint32_t chan = d->type2.channel;
+            uint32_t slot = chan < ADC_CHANNEL_SLOTS ? s_adc.slot_of[chan] : 0;
+            // A slot already complete in pending is skipped, not started
+            // again: overwriting its value would mix two blocks. With the
+            // round-robin pattern this only happens after a lost conversion,
+            // and skipping realigns the channels.
+            if (slot-- == 0 || (s_adc.done & (1u << slot))) {
+                __atomic_store_n(&s_adc.stats.bad_samples, s_adc.stats.bad_samples + 1,
+                                 __ATOMIC_RELAXED);
+                continue;
+            }
+            s_adc.sum[slot] += d->type2.data;
+            if (++s_adc.count[slot] < SENDER_ADC_BLOCK_SAMPLES) {
+                continue;
+            }
+            // Sum of 4^n samples >> n: n more bits than one sample
+            s_adc.pending.value[slot] = (uint16_t)(s_adc.sum[slot] >> SENDER_ADC_OVERSAMPLE_BITS);
+            s_adc.sum[slot] = 0;
+            s_adc.count[slot] = 0;
+            s_adc.done |= 1u << slot;
+            if (s_adc.done == all) {
+                *out = s_adc.pending;
+                s_adc.done = 0;
+                __atomic_store_n(&s_adc.stats.blocks, s_adc.stats.blocks + 1, __ATOMIC_RELAXED);
+                return ESP_OK;
+            }
+        }
+        uint32_t len = 0;
+        if (adc_continuous_read(s_adc.adc, s_adc.buf, s_adc.frame_bytes, &len, 0) != ESP_OK ||
+            len < SOC_ADC_DIGI_RESULT_BYTES) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        s_adc.buf_len = len - len % SOC_ADC_DIGI_RESULT_BYTES;
+        s_adc.buf_pos = 0;
+    }
+}
+
+void sender_adc_get_stats(sender_adc_stats_t *out)
+{
+    out->blocks = __atomic_load_n(&s_adc.stats.blocks, __ATOMIC_RELAXED);
+    out->dropped_frames = __atomic_load_n(&s_adc.stats.dropped_frames, __ATOMIC_RELAXED);
+    out->bad_samples = __atomic_load_n(&s_adc.stats.bad_samples, __ATOMIC_RELAXED);
+}
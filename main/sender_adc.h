@@ -0,0 +1,89 @@
+/**
+ * Analog Sender Sampling
+ *
+ * The ADC runs in continuous mode: its DMA fills frames of conversions
+ * at a fixed rate with no CPU involvement, round-robin over up to
+ * SENDER_ADC_MAX_CHANNELS ADC1 pins. sender_adc_read() drains the
+ * delivered frames and decimates them: each channel's
+ * SENDER_ADC_BLOCK_SAMPLES samples are summed and scaled to one
+ * SENDER_ADC_RESULT_BITS-bit value (4^n oversampling gives n extra bits).
+ * Callers only ever see those averaged blocks.
+ *
+ * The driver's frame pool holds SENDER_ADC_POOL_FRAMES frames; a
+ * conversion frame that finds it full is dropped and counted.
+ */
+
+#ifndef SENDER_ADC_H
+#define SENDER_ADC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SENDER_ADC_MAX_CHANNELS     4
+/** Raw conversion width */
+#define SENDER_ADC_RAW_BITS         12
+/** Extra bits from oversampling: a block is 4^n samples per channel */
+#define SENDER_ADC_OVERSAMPLE_BITS  3
+#define SENDER_ADC_BLOCK_SAMPLES    (1 << (2 * SENDER_ADC_OVERSAMPLE_BITS))
+#define SENDER_ADC_RESULT_BITS      (SENDER_ADC_RAW_BITS + SENDER_ADC_OVERSAMPLE_BITS)
+/** Block value at ADC full scale */
+#define SENDER_ADC_RESULT_MAX       (((1 << SENDER_ADC_RAW_BITS) - 1) << SENDER_ADC_OVERSAMPLE_BITS)
+/** DMA frames the driver can hold before dropping */
+#define SENDER_ADC_POOL_FRAMES      8
+
+/**
+ * @brief Sampling configuration
+ */
+typedef struct {
+    const gpio_num_t *gpios;    /*!< ADC1 pins, in block order */
+    size_t num_channels;        /*!< 1..SENDER_ADC_MAX_CHANNELS */
+    uint32_t sample_hz;         /*!< Conversions per second per channel */
+} sender_adc_config_t;
+
+/**
+ * @brief One decimated block: SENDER_ADC_BLOCK_SAMPLES samples per channel
+ */
+typedef struct {
+    uint16_t value[SENDER_ADC_MAX_CHANNELS];    /*!< 0..SENDER_ADC_RESULT_MAX, config order */
+} sender_adc_block_t;
+
+/**
+ * @brief Sampling counters
+ */
+typedef struct {
+    uint32_t blocks;            /*!< Blocks returned */
+    uint32_t dropped_frames;    /*!< DMA frames dropped on a full pool */
+    uint32_t bad_samples;       /*!< Conversions for a channel not configured, or one
+                                     already complete in the block being filled */
+} sender_adc_stats_t;
+
+/**
+ * @brief Configure the channels and start conversions
+ *
+ * The DMA interrupt lands on the calling core.
+ */
+esp_err_t sender_adc_start(const sender_adc_config_t *config);
+
+/**
+ * @brief Next complete block, without blocking (one task)
+ *
+ * @return ESP_OK with a block, ESP_ERR_NOT_FOUND if none is complete yet
+ */
+esp_err_t sender_adc_read(sender_adc_block_t *out);
+
+/**
+ * @brief Read the counters (any task)
+ */
+void sender_adc_get_stats(sender_adc_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENDER_ADC_H */
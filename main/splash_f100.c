@@ -0,0 +1,408 @@
+// Generated by tools/splash_rle565.py from placeholder badge - do not edit
+// 360x360 RGB565, 6291 bytes RLE565 (raw 259200 bytes)
+
+#include "st77916_panel.h"
+
+static const uint8_t s_rle[] = {
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC1, 0x00,
+    0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB6, 0x00, 0x00, 0xBD, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x90, 0x00, 0x00, 0xDD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x83, 0x00,
+    0x00, 0xE9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xEE, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0xB5, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xBD, 0xB1, 0x11, 0xAC, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xCF, 0xB1, 0x11, 0xA6, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xC5, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xDD, 0xB1, 0x11, 0xA3, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xBE, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xE9, 0xB1, 0x11, 0xA0, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xB8, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0xF3, 0xB1, 0x11, 0x9E, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xB2,
+    0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFD, 0xB1, 0x11, 0x9C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAC, 0x00,
+    0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x87, 0xB1, 0x11, 0x9A, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xA7, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x8F, 0xB1, 0x11, 0x98, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xA2, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x95, 0xB1, 0x11, 0x98, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x9D, 0xB1, 0x11,
+    0x96, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x98, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xA3,
+    0xB1, 0x11, 0x96, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x93, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xFF, 0xB1,
+    0x11, 0xAB, 0xB1, 0x11, 0x94, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x93, 0xFF, 0xFF,
+    0xFF, 0xB1, 0x11, 0xB1, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x93,
+    0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xB5, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x87, 0x00,
+    0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xBB, 0xB1, 0x11, 0x92, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x83, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xC1, 0xB1, 0x11, 0x91, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xC5, 0xB1, 0x11, 0x91, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xCB, 0xB1, 0x11, 0x90, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xCF, 0xB1, 0x11, 0x90, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xD3, 0xB1, 0x11, 0x8F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0xFF, 0xB1, 0x11, 0xD7, 0xB1, 0x11, 0x8F, 0xFF, 0xFF, 0xED, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xB1, 0x11, 0xDB, 0xB1, 0x11, 0x8F, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF,
+    0xB1, 0x11, 0xDF, 0xB1, 0x11, 0x8E, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xB1,
+    0x11, 0xE3, 0xB1, 0x11, 0x8E, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xB1, 0x11,
+    0xE7, 0xB1, 0x11, 0x8D, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xEB,
+    0xB1, 0x11, 0x8D, 0xFF, 0xFF, 0xDE, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xED, 0xB1,
+    0x11, 0x8D, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xF1, 0xB1, 0x11,
+    0x8C, 0xFF, 0xFF, 0xD9, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xF5, 0xB1, 0x11, 0x8C,
+    0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xF7, 0xB1, 0x11, 0x8C, 0xFF,
+    0xFF, 0xD4, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFB, 0xB1, 0x11, 0x8B, 0xFF, 0xFF,
+    0xD2, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFD, 0xB1, 0x11, 0x8B, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x8B, 0xFF, 0xFF, 0xCE, 0x00,
+    0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x83, 0xB1, 0x11, 0x8A, 0xFF, 0xFF,
+    0xCC, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x85, 0xB1, 0x11, 0x8A,
+    0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x87, 0xB1,
+    0x11, 0x8A, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0x91, 0xB1, 0x11, 0xB1, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0x9B, 0xB1, 0x11, 0x8A, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x93, 0xB1,
+    0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x89,
+    0xFF, 0xFF, 0x94, 0xB1, 0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1,
+    0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC2, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x95, 0xB1, 0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9F, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x96, 0xB1, 0x11, 0xB1, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x97, 0xB1,
+    0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x89,
+    0xFF, 0xFF, 0x98, 0xB1, 0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1,
+    0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xBB, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x98, 0xB1, 0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA2, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x99, 0xB1, 0x11, 0xB1, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x9A, 0xB1,
+    0x11, 0xB1, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x9D, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xB7, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9B, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9B, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9C, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9C, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x89,
+    0xFF, 0xFF, 0x9C, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9C, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x88,
+    0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x88, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x93, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF,
+    0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF,
+    0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF,
+    0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF,
+    0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0xA7, 0xFF, 0xFF, 0xA7, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA4, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA3, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA3, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA3, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA3, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA2, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA2, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA2, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA1, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA1, 0xB1,
+    0x11, 0x87, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA0, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xA0, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9F, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9F, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9E, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9E, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9E, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x9C, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9C, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9C, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9C, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x9B, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC5, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89,
+    0xFF, 0xFF, 0x89, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0x9B, 0xB1,
+    0x11, 0x88, 0xFF, 0xFF, 0xB7, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x9A, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0xA4, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x99, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x89,
+    0xFF, 0xFF, 0x98, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA2, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xBB, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x98, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA2, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x97, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0xA1, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x96, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0xA0, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x89,
+    0xFF, 0xFF, 0x95, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1,
+    0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9F, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xC2, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x94, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9E, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x93, 0xB1, 0x11, 0x89, 0xFF, 0xFF,
+    0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D,
+    0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x89, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0x91, 0xB1,
+    0x11, 0x89, 0xFF, 0xFF, 0xBB, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF,
+    0x9D, 0xB1, 0x11, 0x9D, 0xFF, 0xFF, 0x9B, 0xB1, 0x11, 0x8A, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x8A,
+    0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x87, 0xB1, 0x11, 0x8A, 0xFF, 0xFF, 0xCA, 0x00,
+    0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x85, 0xB1, 0x11, 0x8A, 0xFF, 0xFF,
+    0xCC, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x83, 0xB1, 0x11, 0x8A,
+    0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFF, 0xB1, 0x11, 0x8B, 0xFF,
+    0xFF, 0xD0, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFD, 0xB1, 0x11, 0x8B, 0xFF, 0xFF,
+    0xD2, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xFB, 0xB1, 0x11, 0x8B, 0xFF, 0xFF, 0xD4,
+    0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xF7, 0xB1, 0x11, 0x8C, 0xFF, 0xFF, 0xD6, 0x00,
+    0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xF5, 0xB1, 0x11, 0x8C, 0xFF, 0xFF, 0xD9, 0x00, 0x00,
+    0x8C, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xF1, 0xB1, 0x11, 0x8C, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x8D,
+    0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xED, 0xB1, 0x11, 0x8D, 0xFF, 0xFF, 0xDE, 0x00, 0x00, 0x8D, 0xFF,
+    0xFF, 0xFF, 0xB1, 0x11, 0xEB, 0xB1, 0x11, 0x8D, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x8D, 0xFF, 0xFF,
+    0xFF, 0xB1, 0x11, 0xE7, 0xB1, 0x11, 0x8D, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF,
+    0xB1, 0x11, 0xE3, 0xB1, 0x11, 0x8E, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xB1,
+    0x11, 0xDF, 0xB1, 0x11, 0x8E, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xB1, 0x11,
+    0xDB, 0xB1, 0x11, 0x8F, 0xFF, 0xFF, 0xED, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xD7,
+    0xB1, 0x11, 0x8F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xD3, 0xB1,
+    0x11, 0x8F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xCF, 0xB1, 0x11,
+    0x90, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xCB, 0xB1, 0x11, 0x90,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xC5, 0xB1, 0x11, 0x91, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xC1, 0xB1, 0x11, 0x91, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x83, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xBB, 0xB1, 0x11, 0x92,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x87, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0xB5, 0xB1,
+    0x11, 0x93, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xB1, 0x11,
+    0xB1, 0xB1, 0x11, 0x93, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xFF,
+    0xB1, 0x11, 0xAB, 0xB1, 0x11, 0x94, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x93, 0x00, 0x00, 0x96, 0xFF,
+    0xFF, 0xFF, 0xB1, 0x11, 0xA3, 0xB1, 0x11, 0x96, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x98, 0x00, 0x00,
+    0x96, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x9D, 0xB1, 0x11, 0x96, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x9D,
+    0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x95, 0xB1, 0x11, 0x98, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xA2, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x8F, 0xB1, 0x11, 0x98, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xB1, 0x11, 0x87, 0xB1, 0x11, 0x9A,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFD, 0xB1, 0x11, 0x9C, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0xF3, 0xB1, 0x11, 0x9E, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xE9, 0xB1, 0x11, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xBE, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xDD, 0xB1, 0x11, 0xA3, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xC5, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xCF, 0xB1, 0x11, 0xA6, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xCC, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xBD, 0xB1, 0x11, 0xAC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xA3, 0xB1, 0x11, 0xB5, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xDB, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE4, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xEE, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE9,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x83, 0x00, 0x00, 0xDD, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x90, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xA0, 0x00, 0x00, 0xBD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB6, 0x00, 0x00, 0xA3,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xC1, 0x00, 0x00,
+};
+
+const st77916_splash_t splash_f100 = {
+    .w = 360,
+    .h = 360,
+    .rle = s_rle,
+    .rle_len = sizeof(s_rle),
+};
@@ -0,0 +1,191 @@
+/**
+ * ST77916 Shared-Bus Scheduler
+ *
+ * Start-time fair queuing: every request gets a virtual start tag (the
+ * later of the bus's virtual clock and the client's previous finish tag)
+ * and a finish tag start + bytes / weight. A freed slot goes to the
+ * waiting request with the smallest start tag, so a client's share of
+ * the bus under contention follows its weight, while a client that was
+ * idle cannot bank credit. Each client has at most one request pending
+ * (a panel streams from a single task).
+ */
+
+#include "st77916_bus_sched.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+// Virtual time units per byte at weight 1
+#define SCHED_VTIME_SCALE       16
+
+typedef struct {
+    uint8_t weight;
+    bool waiting;
+    uint64_t start_tag;
+    uint64_t finish_tag;
+    int64_t wait_start_us;
+    SemaphoreHandle_t grant;
+    st77916_bus_sched_stats_t stats;
+} sched_client_t;
+
+struct st77916_bus_sched_t {
+    portMUX_TYPE lock;
+    uint8_t free_slots;
+    uint8_t num_clients;
+    uint64_t vclock;
+    sched_client_t clients[ST77916_BUS_SCHED_MAX_CLIENTS];
+};
+
+esp_err_t st77916_bus_sched_new(uint8_t slots, st77916_bus_sched_handle_t *ret_sched)
+{
+    if (slots == 0 || !ret_sched) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct st77916_bus_sched_t *sched = heap_caps_calloc(1, sizeof(*sched), MALLOC_CAP_INTERNAL);
+    if (!sched) {
+        return ESP_ERR_NO_MEM;
+    }
+    portMUX_TYPE unlocked = portMUX_INITIALIZER_UNLOCKED;
+    sched->lock = unlocked;
+    sched->free_slots = slots;
+    *ret_sched = sched;
+    return ESP_OK;
+}
+
+esp_err_t st77916_bus_sched_add_client(st77916_bus_sched_handle_t sched, uint8_t weight,
+                                       uint8_t *ret_client)
+{
+    if (!sched || !ret_client) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    SemaphoreHandle_t grant = xSemaphoreCreateBinary();
+    if (!grant) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&sched->lock);
+    // Reuse a removed client's index before growing the table
+    uint8_t i = 0;
+    while (i < sched->num_clients && sched->clients[i].grant) {
+        i++;
+    }
+    if (i == ST77916_BUS_SCHED_MAX_CLIENTS) {
+        portEXIT_CRITICAL(&sched->lock);
+        vSemaphoreDelete(grant);
+        return ESP_ERR_NO_MEM;
+    }
+    sched_client_t *c = &sched->clients[i];
+    c->grant = grant;
+    c->weight = weight ? weight : 1;
+    // Start level with the others instead of owed the time since boot
+    c->finish_tag = sched->vclock;
+    if (i == sched->num_clients) {
+        sched->num_clients++;
+    }
+    *ret_client = i;
+    portEXIT_CRITICAL(&sched->lock);
+    return ESP_OK;
+}
+
+esp_err_t st77916_bus_sched_remove_client(st77916_bus_sched_handle_t sched, uint8_t client)
+{
+    if (!sched || client >= sched->num_clients || !sched->clients[client].grant) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    sched_client_t *c = &sched->clients[client];
+
+    portENTER_CRITICAL(&sched->lock);
+    if (c->waiting) {
+        portEXIT_CRITICAL(&sched->lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    SemaphoreHandle_t grant = c->grant;
+    // A NULL grant marks the index free; trailing free indexes are dropped
+    memset(c, 0, sizeof(*c));
+    while (sched->num_clients > 0 && !sched->clients[sched->num_clients - 1].grant) {
+        sched->num_clients--;
+    }
+    portEXIT_CRITICAL(&sched->lock);
+    vSemaphoreDelete(grant);
+    return ESP_OK;
+}
+
+void st77916_bus_sched_acquire(st77916_bus_sched_handle_t sched, uint8_t client, size_t bytes)
+{
+    sched_client_t *c = &sched->clients[client];
+
+    portENTER_CRITICAL(&sched->lock);
+    c->start_tag = (c->finish_tag > sched->vclock) ? c->finish_tag : sched->vclock;
+    c->finish_tag = c->start_tag + (uint64_t)bytes * SCHED_VTIME_SCALE / c->weight;
+    c->stats.grants++;
+    c->stats.bytes += bytes;
+    if (sched->free_slots > 0) {
+        // A free slot means nobody is waiting: release() hands slots over directly
+        sched->free_slots--;
+        sched->vclock = c->start_tag;
+        portEXIT_CRITICAL(&sched->lock);
+        return;
+    }
+    c->waiting = true;
+    c->wait_start_us = esp_timer_get_time();
+    c->stats.waits++;
+    portEXIT_CRITICAL(&sched->lock);
+
+    xSemaphoreTake(c->grant, portMAX_DELAY);
+}
+
+bool IRAM_ATTR st77916_bus_sched_release(st77916_bus_sched_handle_t sched)
+{
+    bool in_isr = xPortInIsrContext();
+    sched_client_t *next = NULL;
+
+    if (in_isr) {
+        portENTER_CRITICAL_ISR(&sched->lock);
+    } else {
+        portENTER_CRITICAL(&sched->lock);
+    }
+    for (uint8_t i = 0; i < sched->num_clients; i++) {
+        sched_client_t *c = &sched->clients[i];
+        if (c->waiting && (!next || c->start_tag < next->start_tag)) {
+            next = c;
+        }
+    }
+    if (next) {
+        // The slot passes straight to the next client
+        next->waiting = false;
+        next->stats.wait_us += esp_timer_get_time() - next->wait_start_us;
+        sched->vclock = next->start_tag;
+    } else {
+        sched->free_slots++;
+    }
+    if (in_isr) {
+        portEXIT_CRITICAL_ISR(&sched->lock);
+    } else {
+        portEXIT_CRITICAL(&sched->lock);
+    }
+
+    if (!next) {
+        return false;
+    }
+    if (!in_isr) {
+        xSemaphoreGive(next->grant);
+        return false;
+    }
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(next->grant, &woken);
+    return woken == pdTRUE;
+}
+
+void st77916_bus_sched_get_stats(st77916_bus_sched_handle_t sched, uint8_t client,
+                                 st77916_bus_sched_stats_t *out_stats)
+{
+    if (!sched || client >= sched->num_clients || !out_stats) {
+        return;
+    }
+    portENTER_CRITICAL(&sched->lock);
+    *out_stats = sched->clients[client].stats;
+    portEXIT_CRITICAL(&sched->lock);
+}
@@ -0,0 +1,93 @@
+/**
+ * ST77916 Shared-Bus Scheduler
+ *
+ * Several panels on one QSPI bus each queue color transfers on their own
+ * SPI device, and the SPI driver would serve them in whatever order they
+ * arrive. The scheduler sits in front of the queues: a fixed number of
+ * transfer slots per bus (enough to keep the bus busy, few enough that
+ * the order is decided here) is handed out by weighted fair queuing, so
+ * under contention each panel gets bus time in proportion to its weight
+ * and a heavier one (the tachometer) sees its frames finish first.
+ */
+
+#ifndef ST77916_BUS_SCHED_H
+#define ST77916_BUS_SCHED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of panels sharing one scheduler */
+#define ST77916_BUS_SCHED_MAX_CLIENTS   8
+
+typedef struct st77916_bus_sched_t *st77916_bus_sched_handle_t;
+
+/**
+ * @brief Per-client counters
+ */
+typedef struct {
+    uint32_t grants;            /*!< Transfer slots granted */
+    uint32_t waits;             /*!< Grants that had to wait for a slot */
+    uint64_t bytes;             /*!< Bytes sent through granted slots */
+    uint64_t wait_us;           /*!< Time spent waiting for slots */
+} st77916_bus_sched_stats_t;
+
+/**
+ * @brief Create a scheduler for one bus
+ *
+ * @param slots Color transfers allowed in flight on the bus at once (>= 1;
+ *              2 keeps one transfer queued behind the active one)
+ * @param ret_sched Returned scheduler handle
+ */
+esp_err_t st77916_bus_sched_new(uint8_t slots, st77916_bus_sched_handle_t *ret_sched);
+
+/**
+ * @brief Register a panel with the scheduler
+ *
+ * @param weight Relative share of the bus under contention (0 counts as 1)
+ * @param ret_client Returned client index
+ */
+esp_err_t st77916_bus_sched_add_client(st77916_bus_sched_handle_t sched, uint8_t weight,
+                                       uint8_t *ret_client);
+
+/**
+ * @brief Unregister a client; its index may be handed out again
+ *
+ * The client must hold no slot and have no request pending.
+ */
+esp_err_t st77916_bus_sched_remove_client(st77916_bus_sched_handle_t sched, uint8_t client);
+
+/**
+ * @brief Take a transfer slot, blocking until the client's turn
+ *
+ * Task context only.
+ *
+ * @param bytes Size of the transfer the slot is for
+ */
+void st77916_bus_sched_acquire(st77916_bus_sched_handle_t sched, uint8_t client, size_t bytes);
+
+/**
+ * @brief Return a slot once its transfer has completed
+ *
+ * Callable from the transfer-done ISR as well as from a task.
+ *
+ * @return true if a higher priority task was woken (ISR context)
+ */
+bool st77916_bus_sched_release(st77916_bus_sched_handle_t sched);
+
+/**
+ * @brief Read a client's counters
+ */
+void st77916_bus_sched_get_stats(st77916_bus_sched_handle_t sched, uint8_t client,
+                                 st77916_bus_sched_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ST77916_BUS_SCHED_H */
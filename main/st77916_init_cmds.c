@@ -0,0 +1,39 @@
+/**
+ * ST77916 Initialization Command Stream
+ *
+ * Expands st77916_init_cmds.def into the packed stream. Each entry's
+ * parameter count comes from the size of its parameter list, so the .def
+ * file carries no lengths that could drift from the data.
+ */
+
+#include "st77916_init_cmds.h"
+
+// Parameter count of an entry (0 for an empty list)
+#define INIT_PARAM_LEN(...)     ((uint8_t)sizeof((const uint8_t[]){ __VA_ARGS__ }))
+
+const uint8_t st77916_init_stream[] = {
+#define ST77916_CMD(cmd, ...) \
+    (cmd), INIT_PARAM_LEN(__VA_ARGS__), ##__VA_ARGS__,
+#define ST77916_CMD_DELAY(cmd, ms, ...) \
+    (cmd), ST77916_INIT_DELAY_FLAG | INIT_PARAM_LEN(__VA_ARGS__), (ms), ##__VA_ARGS__,
+#include "st77916_init_cmds.def"
+#undef ST77916_CMD
+#undef ST77916_CMD_DELAY
+};
+
+const size_t st77916_init_stream_size = sizeof(st77916_init_stream);
+
+const uint8_t *st77916_init_cmd_next(const uint8_t *pos, st77916_init_cmd_t *out)
+{
+    const uint8_t *end = st77916_init_stream + st77916_init_stream_size;
+
+    if (pos >= end) {
+        return NULL;
+    }
+    out->cmd = *pos++;
+    uint8_t flags_len = *pos++;
+    out->len = flags_len & ST77916_INIT_LEN_MASK;
+    out->delay_ms = (flags_len & ST77916_INIT_DELAY_FLAG) ? *pos++ : 0;
+    out->data = out->len ? pos : NULL;
+    return pos + out->len;
+}
@@ -0,0 +1,68 @@
+/**
+ * ST77916 Initialization Command Stream
+ *
+ * The manufacturer's init sequence, defined once in st77916_init_cmds.def
+ * and packed at build time into a variable-length byte stream:
+ *
+ *   cmd, flags_len, [delay_ms], params[len]
+ *
+ * flags_len holds the parameter count in its low 7 bits; bit 7 says a
+ * delay byte follows. One-parameter commands take 3 bytes instead of a
+ * padded table row. Pure C, no ESP-IDF dependencies.
+ */
+
+#ifndef ST77916_INIT_CMDS_H
+#define ST77916_INIT_CMDS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ST77916_INIT_DELAY_FLAG     0x80
+#define ST77916_INIT_LEN_MASK       0x7F
+
+/** Number of commands in the stream */
+enum {
+    ST77916_INIT_CMD_COUNT = 0
+#define ST77916_CMD(cmd, ...)           + 1
+#define ST77916_CMD_DELAY(cmd, ms, ...) + 1
+#include "st77916_init_cmds.def"
+#undef ST77916_CMD
+#undef ST77916_CMD_DELAY
+};
+
+/**
+ * @brief One decoded command
+ */
+typedef struct {
+    uint8_t cmd;                /*!< Command byte */
+    uint8_t len;                /*!< Number of parameter bytes */
+    uint8_t delay_ms;           /*!< Wait after the command, 0 for none */
+    const uint8_t *data;        /*!< Parameters (inside the stream), NULL if len is 0 */
+} st77916_init_cmd_t;
+
+/** Packed command stream */
+extern const uint8_t st77916_init_stream[];
+
+/** Size of st77916_init_stream in bytes */
+extern const size_t st77916_init_stream_size;
+
+/**
+ * @brief Decode the command at pos
+ *
+ * Start with pos = st77916_init_stream and feed back the return value.
+ *
+ * @param pos Position in the stream
+ * @param out Decoded command
+ * @return Position of the next command, NULL at the end of the stream
+ */
+const uint8_t *st77916_init_cmd_next(const uint8_t *pos, st77916_init_cmd_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ST77916_INIT_CMDS_H */
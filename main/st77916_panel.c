@@ -2,18 +2,37 @@
  * Custom ST77916 QSPI Panel Driver
  *
  * Features:
- * - Manufacturer's 193-command initialization sequence
+ * - Manufacturer's initialization sequence, packed into a shared byte stream
  * - RGB565 byte-swap for correct color display (ESP32 little-endian to display big-endian)
  * - DMA-safe pixel transfer with completion synchronization
+ * - Pre-allocated DMA staging buffer pool (no heap use on the flush path)
+ * - Optional async flush: completion reported from the color-done ISR
+ * - Chunked streaming: swap of chunk k+1 overlaps DMA of chunk k (RAMWR + RAMWRC)
+ * - Round-glass clipping: pixels outside the visible circle are never sent
+ * - Selectable bus pixel format (RGB565/444/666), packed in the swap pass
+ * - Optional PSRAM shadow framebuffer: only row spans that changed are sent
+ * - Two transports behind the same draw API: esp_lcd panel IO, or direct
+ *   spi_master with polled commands and queued DMA pixel transactions
+ * - Optional async bring-up task: reset and SLPOUT delays overlap the app's
+ *   own startup, and the first frame reaches GRAM before DISPON
+ * - RLE565 splash decompressed from flash straight into the staging buffers
  */
 
 #include "st77916_panel.h"
+#include "st77916_pixel.h"
+#include "st77916_init_cmds.h"
 #include "esp_log.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
 #include "driver/spi_master.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include <math.h>
 #include <string.h>
 
 static const char *TAG = "ST77916_DIRECT";
@@ -22,6 +41,9 @@ static const char *TAG = "ST77916_DIRECT";
 #define QSPI_CMD_WRITE_CMD      0x02
 #define QSPI_CMD_WRITE_COLOR    0x32
 
+// Every QSPI frame starts with an 8-bit opcode and a 24-bit address (cmd << 8)
+#define QSPI_HEADER_BYTES       4
+
 // Manufacturer's approach: direct LCD command for pixel data
 #define LCD_CMD_RAMWRC      0x3C    // RAM Write Continue (manufacturer uses this)
 
@@ -36,482 +58,1040 @@ static const char *TAG = "ST77916_DIRECT";
 #define LCD_CMD_INVON       0x21
 #define LCD_CMD_TEON        0x35
 
-// Store handles
-static esp_lcd_panel_io_handle_t g_io_handle = NULL;
-static spi_device_handle_t g_spi_device = NULL;
+// DMA staging buffers must be word aligned for the GDMA engine
+#define ST77916_DMA_ALIGN   4
 
-/**
- * @brief Swap bytes of RGB565 color for correct endianness
- *
- * The ESP32 is little-endian but the ST77916 expects big-endian RGB565 data.
- * This function swaps the high and low bytes to correct the byte order.
- *
- * @param color Original RGB565 color (native endian)
- * @return Byte-swapped RGB565 color for display
- */
-static inline uint16_t swap_bytes_rgb565(uint16_t color)
+// In-flight color transfer ring (power of two, >= panel IO trans_queue_depth)
+#define INFLIGHT_RING_SIZE  8
+
+// Round clipping: pixels a row may be padded by to stay in the current band
+#define CLIP_BAND_SLACK_PX  24
+
+// Shadow framebuffer: send the whole tile once this share of it changed
+#define SHADOW_FULL_PCT_DEFAULT 50
+
+// Direct SPI: color transactions queued at once (<= INFLIGHT_RING_SIZE)
+#define DIRECT_QUEUE_SIZE   4
+
+// Async bring-up task: above the LVGL task so panel delays end on time
+#define BRINGUP_TASK_PRIORITY   6
+#define BRINGUP_TASK_STACK      3072
+#define BRINGUP_DONE_BIT        (1 << 0)
+
+// RLE565 images are decoded this many pixels at a time, then packed
+#define RLE_SLICE_PIXELS        64
+
+// Staging buffer pool: byte-swapped pixels are built here before transfer
+typedef struct {
+    uint8_t *bufs[ST77916_POOL_MAX_BUFS];
+    uint8_t num_bufs;
+    size_t buf_size;                // Bytes per staging buffer
+    size_t chunk_pixels;            // Pixels per color transfer (fills buf_size in the current format)
+    QueueHandle_t free_q;           // Holds pointers of idle buffers
+} staging_pool_t;
+
+// One queued esp_lcd_panel_io_tx_color() call, retired by the color-done ISR
+typedef struct {
+    uint8_t *buf;                   // Staging buffer to recycle, NULL if caller-owned
+    bool end_of_tile;               // Last transfer of a draw_bitmap call
+    int64_t queued_us;              // When the transfer was handed to the bus
+} xfer_t;
+
+// Bus pixel formats: COLMOD value and bits per pixel on the wire
+static const struct {
+    uint8_t colmod;
+    uint8_t bits;
+} g_formats[] = {
+    [ST77916_PIXEL_RGB565] = { 0x05, 16 },
+    [ST77916_PIXEL_RGB444] = { 0x03, 12 },
+    [ST77916_PIXEL_RGB666] = { 0x06, 24 },     // 18 significant bits in 3 bytes
+};
+
+// Staging buffer writer: converts source pixels into the given format.
+// RGB444 packs pixel pairs, so an odd pixel is carried to the next run.
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    st77916_pixel_format_t fmt;
+    bool carry;
+    uint16_t carry_px;
+} pack_t;
+
+// Horizontal pixel run [x0, x1); empty when x0 >= x1
+typedef struct {
+    int16_t x0;
+    int16_t x1;
+} span_t;
+
+// Rectangle sent as one address window, end coordinates exclusive
+typedef struct {
+    int16_t x0, y0;
+    int16_t x1, y1;
+} band_t;
+
+// One panel: everything below is per CS line
+struct st77916_panel_t {
+    esp_lcd_panel_io_handle_t io;
+    st77916_transport_t transport;
+    uint16_t h_res;
+    uint16_t v_res;
+
+    // Direct SPI transport state
+    struct {
+        spi_host_device_t host;
+        int cs_gpio;
+        int pclk_hz;
+        spi_device_handle_t dev;
+        spi_transaction_ext_t trans[DIRECT_QUEUE_SIZE];    // Descriptors of queued color transfers
+        uint32_t next;              // Next descriptor to use
+        uint32_t queued;            // Queued transfers whose result is not yet collected
+        bool bus_acquired;
+    } direct;
+
+    // Shared-bus scheduling: one slot is held per queued color transfer
+    st77916_bus_sched_handle_t sched;
+    uint8_t sched_client;
+
+    staging_pool_t pool;
+
+    // Color transfers complete in submission order, so a SPSC ring suffices:
+    // the flushing task pushes at the tail, the ISR pops at the head.
+    struct {
+        xfer_t ring[INFLIGHT_RING_SIZE];
+        volatile uint32_t head;
+        volatile uint32_t tail;
+        int64_t last_done_us;
+    } inflight;
+
+    // Completion reporting
+    st77916_flush_done_cb_t flush_done_cb;
+    void *flush_done_ctx;
+    SemaphoreHandle_t done_sem;     // Sync mode: signalled per tile
+
+    st77916_panel_stats_t stats;
+    st77916_pixel_format_t fmt;
+
+    // Last address window sent to the panel (raw CASET/RASET parameters)
+    struct {
+        bool caset_valid;
+        bool raset_valid;
+        uint8_t caset[4];
+        uint8_t raset[4];
+    } win;
+
+    // Per-row span state, used for round-glass clipping and the shadow diff
+    struct {
+        bool enabled;               // Tiles are sent as per-row spans
+        bool round;                 // row_vis is the inscribed circle, not full rows
+        int h_res;
+        int v_res;
+        span_t *row_vis;            // Visible columns per panel row
+        span_t *row_span;           // Scratch: spans of the tile being drawn
+        band_t *bands;              // Scratch: windows of the tile being drawn
+    } clip;
+
+    // Panel bring-up (reset + init sequence), possibly on its own task
+    struct {
+        gpio_num_t rst_gpio;
+        st77916_bringup_cb_t on_phase;
+        void *user_ctx;
+        volatile bool ready;        // DISPON sent: GRAM writes go to the bus
+        esp_err_t result;           // Outcome once BRINGUP_DONE_BIT is set
+        EventGroupHandle_t events;
+        SemaphoreHandle_t lock;     // Orders early draws against the first-frame push
+        bool frame_pending;         // Tiles were drawn into the shadow before ready
+        const st77916_splash_t *splash; // Shown at DISPON if no frame is pending
+    } bringup;
+
+    // Shadow framebuffer: the pixels last sent to GRAM, in LVGL's RGB565
+    struct {
+        uint16_t *fb;               // h_res x v_res, in PSRAM
+        uint8_t *row_valid;         // Row mirrors GRAM across its whole visible span
+        uint8_t full_pct;
+    } shadow;
+};
+
+// Bytes needed on the wire for a run of pixels in the panel's current format
+static inline size_t fmt_bytes(const st77916_panel_t *panel, size_t num_pixels)
 {
-    // RGB565 format: RRRRRGGG GGGBBBBB (16-bit)
-    // ESP32 sends little-endian: low byte first, then high byte
-    // ST77916 expects big-endian: high byte first, then low byte
-    // Swap bytes to correct the order
-    return ((color >> 8) & 0xFF) | ((color << 8) & 0xFF00);
+    return (num_pixels * g_formats[panel->fmt].bits + 7) / 8;
 }
 
 /**
- * @brief Apply byte-swap to entire pixel buffer
+ * @brief Allocate the staging buffer pool
  *
- * @param dst Destination buffer (can be same as src for in-place)
- * @param src Source buffer
- * @param num_pixels Number of RGB565 pixels
+ * Called once from st77916_panel_new(); buffers live for the lifetime of the
+ * panel so the flush path never touches the heap.
  */
-static void swap_bytes_buffer(uint16_t *dst, const uint16_t *src, size_t num_pixels)
+static esp_err_t pool_init(st77916_panel_t *panel, size_t buf_size, uint8_t num_bufs)
 {
-    for (size_t i = 0; i < num_pixels; i++) {
-        dst[i] = swap_bytes_rgb565(src[i]);
+    if (num_bufs == 0 || num_bufs > ST77916_POOL_MAX_BUFS || buf_size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    buf_size = (buf_size + ST77916_DMA_ALIGN - 1) & ~(size_t)(ST77916_DMA_ALIGN - 1);
+
+    panel->pool.free_q = xQueueCreate(num_bufs, sizeof(uint8_t *));
+    if (!panel->pool.free_q) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (uint8_t i = 0; i < num_bufs; i++) {
+        uint8_t *buf = heap_caps_aligned_alloc(ST77916_DMA_ALIGN, buf_size,
+                                               MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (!buf) {
+            ESP_LOGE(TAG, "Failed to allocate staging buffer %d (%d bytes)", i, buf_size);
+            for (uint8_t j = 0; j < i; j++) {
+                heap_caps_free(panel->pool.bufs[j]);
+                panel->pool.bufs[j] = NULL;
+            }
+            vQueueDelete(panel->pool.free_q);
+            panel->pool.free_q = NULL;
+            return ESP_ERR_NO_MEM;
+        }
+        panel->pool.bufs[i] = buf;
+        xQueueSend(panel->pool.free_q, &buf, 0);
     }
+
+    panel->pool.num_bufs = num_bufs;
+    panel->pool.buf_size = buf_size;
+    ESP_LOGI(TAG, "Staging pool: %d x %d bytes", num_bufs, buf_size);
+    return ESP_OK;
 }
 
-// Helper to send command via panel_io (for init sequence)
-static esp_err_t send_cmd(esp_lcd_panel_io_handle_t io, uint8_t cmd, const uint8_t *data, size_t len)
+// Take an idle staging buffer, blocking only if all are in flight
+static uint8_t *pool_acquire(st77916_panel_t *panel)
 {
-    int lcd_cmd = (QSPI_CMD_WRITE_CMD << 24) | (cmd << 8);
-    return esp_lcd_panel_io_tx_param(io, lcd_cmd, data, len);
+    uint8_t *buf = NULL;
+    if (xQueueReceive(panel->pool.free_q, &buf, 0) == pdTRUE) {
+        panel->stats.pool_hits++;
+        return buf;
+    }
+    panel->stats.pool_waits++;
+    xQueueReceive(panel->pool.free_q, &buf, portMAX_DELAY);
+    return buf;
 }
 
-// Manufacturer's initialization sequence
-typedef struct {
-    uint8_t cmd;
-    uint8_t data[36];
-    uint8_t len;
-    uint16_t delay_ms;
-} init_cmd_t;
-
-static const init_cmd_t init_sequence[] = {
-    // Vendor-specific initialization
-    {0xF0, {0x28}, 1, 0},
-    {0xF2, {0x28}, 1, 0},
-    {0x73, {0xF0}, 1, 0},
-    {0x7C, {0xD1}, 1, 0},
-    {0x83, {0xE0}, 1, 0},
-    {0x84, {0x61}, 1, 0},
-    {0xF2, {0x82}, 1, 0},
-    {0xF0, {0x00}, 1, 0},
-    {0xF0, {0x01}, 1, 0},
-    {0xF1, {0x01}, 1, 0},
-    {0xB0, {0x69}, 1, 0},
-    {0xB1, {0x4A}, 1, 0},
-    {0xB2, {0x2F}, 1, 0},
-    {0xB3, {0x01}, 1, 0},
-    {0xB4, {0x69}, 1, 0},
-    {0xB5, {0x45}, 1, 0},
-    {0xB6, {0xAB}, 1, 0},
-    {0xB7, {0x41}, 1, 0},
-    {0xB8, {0x86}, 1, 0},
-    {0xB9, {0x15}, 1, 0},
-    {0xBA, {0x00}, 1, 0},
-    {0xBB, {0x08}, 1, 0},
-    {0xBC, {0x08}, 1, 0},
-    {0xBD, {0x00}, 1, 0},
-    {0xBE, {0x00}, 1, 0},
-    {0xBF, {0x07}, 1, 0},
-    {0xC0, {0x80}, 1, 0},
-    {0xC1, {0x10}, 1, 0},
-    {0xC2, {0x37}, 1, 0},
-    {0xC3, {0x80}, 1, 0},
-    {0xC4, {0x10}, 1, 0},
-    {0xC5, {0x37}, 1, 0},
-    {0xC6, {0xA9}, 1, 0},
-    {0xC7, {0x41}, 1, 0},
-    {0xC8, {0x01}, 1, 0},
-    {0xC9, {0xA9}, 1, 0},
-    {0xCA, {0x41}, 1, 0},
-    {0xCB, {0x01}, 1, 0},
-    {0xCC, {0x7F}, 1, 0},
-    {0xCD, {0x7F}, 1, 0},
-    {0xCE, {0xFF}, 1, 0},
-    {0xD0, {0x91}, 1, 0},
-    {0xD1, {0x68}, 1, 0},
-    {0xD2, {0x68}, 1, 0},
-    {0xF5, {0x00, 0xA5}, 2, 0},
-    {0xF1, {0x10}, 1, 0},
-    {0xF0, {0x00}, 1, 0},
-    {0xF0, {0x02}, 1, 0},
-    // Gamma settings
-    {0xE0, {0xF0, 0x10, 0x18, 0x0D, 0x0C, 0x38, 0x3E, 0x44, 0x51, 0x39, 0x15, 0x15, 0x30, 0x34}, 14, 0},
-    {0xE1, {0xF0, 0x0F, 0x17, 0x0D, 0x0B, 0x07, 0x3E, 0x33, 0x51, 0x39, 0x15, 0x15, 0x30, 0x34}, 14, 0},
-    {0xF0, {0x10}, 1, 0},
-    {0xF3, {0x10}, 1, 0},
-    // More vendor settings
-    {0xE0, {0x08}, 1, 0},
-    {0xE1, {0x00}, 1, 0},
-    {0xE2, {0x00}, 1, 0},
-    {0xE3, {0x00}, 1, 0},
-    {0xE4, {0xE0}, 1, 0},
-    {0xE5, {0x06}, 1, 0},
-    {0xE6, {0x21}, 1, 0},
-    {0xE7, {0x03}, 1, 0},
-    {0xE8, {0x05}, 1, 0},
-    {0xE9, {0x02}, 1, 0},
-    {0xEA, {0xE9}, 1, 0},
-    {0xEB, {0x00}, 1, 0},
-    {0xEC, {0x00}, 1, 0},
-    {0xED, {0x14}, 1, 0},
-    {0xEE, {0xFF}, 1, 0},
-    {0xEF, {0x00}, 1, 0},
-    {0xF8, {0xFF}, 1, 0},
-    {0xF9, {0x00}, 1, 0},
-    {0xFA, {0x00}, 1, 0},
-    {0xFB, {0x30}, 1, 0},
-    {0xFC, {0x00}, 1, 0},
-    {0xFD, {0x00}, 1, 0},
-    {0xFE, {0x00}, 1, 0},
-    {0xFF, {0x00}, 1, 0},
-    // Gate/source settings
-    {0x60, {0x40}, 1, 0},
-    {0x61, {0x05}, 1, 0},
-    {0x62, {0x00}, 1, 0},
-    {0x63, {0x42}, 1, 0},
-    {0x64, {0xDA}, 1, 0},
-    {0x65, {0x00}, 1, 0},
-    {0x66, {0x00}, 1, 0},
-    {0x67, {0x00}, 1, 0},
-    {0x68, {0x00}, 1, 0},
-    {0x69, {0x00}, 1, 0},
-    {0x6A, {0x00}, 1, 0},
-    {0x6B, {0x00}, 1, 0},
-    {0x70, {0x40}, 1, 0},
-    {0x71, {0x04}, 1, 0},
-    {0x72, {0x00}, 1, 0},
-    {0x73, {0x42}, 1, 0},
-    {0x74, {0xD9}, 1, 0},
-    {0x75, {0x00}, 1, 0},
-    {0x76, {0x00}, 1, 0},
-    {0x77, {0x00}, 1, 0},
-    {0x78, {0x00}, 1, 0},
-    {0x79, {0x00}, 1, 0},
-    {0x7A, {0x00}, 1, 0},
-    {0x7B, {0x00}, 1, 0},
-    // More panel settings
-    {0x80, {0x48}, 1, 0},
-    {0x81, {0x00}, 1, 0},
-    {0x82, {0x07}, 1, 0},
-    {0x83, {0x02}, 1, 0},
-    {0x84, {0xD7}, 1, 0},
-    {0x85, {0x04}, 1, 0},
-    {0x86, {0x00}, 1, 0},
-    {0x87, {0x00}, 1, 0},
-    {0x88, {0x48}, 1, 0},
-    {0x89, {0x00}, 1, 0},
-    {0x8A, {0x09}, 1, 0},
-    {0x8B, {0x02}, 1, 0},
-    {0x8C, {0xD9}, 1, 0},
-    {0x8D, {0x04}, 1, 0},
-    {0x8E, {0x00}, 1, 0},
-    {0x8F, {0x00}, 1, 0},
-    {0x90, {0x48}, 1, 0},
-    {0x91, {0x00}, 1, 0},
-    {0x92, {0x0B}, 1, 0},
-    {0x93, {0x02}, 1, 0},
-    {0x94, {0xDB}, 1, 0},
-    {0x95, {0x04}, 1, 0},
-    {0x96, {0x00}, 1, 0},
-    {0x97, {0x00}, 1, 0},
-    {0x98, {0x48}, 1, 0},
-    {0x99, {0x00}, 1, 0},
-    {0x9A, {0x0D}, 1, 0},
-    {0x9B, {0x02}, 1, 0},
-    {0x9C, {0xDD}, 1, 0},
-    {0x9D, {0x04}, 1, 0},
-    {0x9E, {0x00}, 1, 0},
-    {0x9F, {0x00}, 1, 0},
-    {0xA0, {0x48}, 1, 0},
-    {0xA1, {0x00}, 1, 0},
-    {0xA2, {0x06}, 1, 0},
-    {0xA3, {0x02}, 1, 0},
-    {0xA4, {0xD6}, 1, 0},
-    {0xA5, {0x04}, 1, 0},
-    {0xA6, {0x00}, 1, 0},
-    {0xA7, {0x00}, 1, 0},
-    {0xA8, {0x48}, 1, 0},
-    {0xA9, {0x00}, 1, 0},
-    {0xAA, {0x08}, 1, 0},
-    {0xAB, {0x02}, 1, 0},
-    {0xAC, {0xD8}, 1, 0},
-    {0xAD, {0x04}, 1, 0},
-    {0xAE, {0x00}, 1, 0},
-    {0xAF, {0x00}, 1, 0},
-    {0xB0, {0x48}, 1, 0},
-    {0xB1, {0x00}, 1, 0},
-    {0xB2, {0x0A}, 1, 0},
-    {0xB3, {0x02}, 1, 0},
-    {0xB4, {0xDA}, 1, 0},
-    {0xB5, {0x04}, 1, 0},
-    {0xB6, {0x00}, 1, 0},
-    {0xB7, {0x00}, 1, 0},
-    {0xB8, {0x48}, 1, 0},
-    {0xB9, {0x00}, 1, 0},
-    {0xBA, {0x0C}, 1, 0},
-    {0xBB, {0x02}, 1, 0},
-    {0xBC, {0xDC}, 1, 0},
-    {0xBD, {0x04}, 1, 0},
-    {0xBE, {0x00}, 1, 0},
-    {0xBF, {0x00}, 1, 0},
-    // Timing settings
-    {0xC0, {0x10}, 1, 0},
-    {0xC1, {0x47}, 1, 0},
-    {0xC2, {0x56}, 1, 0},
-    {0xC3, {0x65}, 1, 0},
-    {0xC4, {0x74}, 1, 0},
-    {0xC5, {0x88}, 1, 0},
-    {0xC6, {0x99}, 1, 0},
-    {0xC7, {0x01}, 1, 0},
-    {0xC8, {0xBB}, 1, 0},
-    {0xC9, {0xAA}, 1, 0},
-    {0xD0, {0x10}, 1, 0},
-    {0xD1, {0x47}, 1, 0},
-    {0xD2, {0x56}, 1, 0},
-    {0xD3, {0x65}, 1, 0},
-    {0xD4, {0x74}, 1, 0},
-    {0xD5, {0x88}, 1, 0},
-    {0xD6, {0x99}, 1, 0},
-    {0xD7, {0x01}, 1, 0},
-    {0xD8, {0xBB}, 1, 0},
-    {0xD9, {0xAA}, 1, 0},
-    // Return to command set 0
-    {0xF3, {0x01}, 1, 0},
-    {0xF0, {0x00}, 1, 0},
-    // Final display configuration
-    {LCD_CMD_MADCTL, {0x00}, 1, 0},
-    {LCD_CMD_COLMOD, {0x05}, 1, 0},
-    {LCD_CMD_TEON, {0x00}, 1, 0},
-    {LCD_CMD_INVON, {0}, 0, 0},
-    {LCD_CMD_SLPOUT, {0}, 0, 120},
-    {LCD_CMD_DISPON, {0}, 0, 0},
-};
+// Record a transfer about to be queued; must precede tx_color()
+static void inflight_push(st77916_panel_t *panel, uint8_t *buf, bool end_of_tile)
+{
+    xfer_t *x = &panel->inflight.ring[panel->inflight.tail & (INFLIGHT_RING_SIZE - 1)];
+    x->buf = buf;
+    x->end_of_tile = end_of_tile;
+    x->queued_us = esp_timer_get_time();
+    panel->inflight.tail++;
+}
 
-esp_err_t st77916_panel_init(esp_lcd_panel_io_handle_t io_handle, gpio_num_t rst_gpio)
+// Undo inflight_push() when tx_color() rejected the transfer
+static void inflight_unpush(st77916_panel_t *panel)
 {
-    esp_err_t ret;
+    panel->inflight.tail--;
+}
 
-    ESP_LOGI(TAG, "Initializing ST77916 with DIRECT SPI driver...");
+/**
+ * @brief Retire the oldest in-flight color transfer (ISR context)
+ *
+ * Recycles the staging buffer and reports tile completion, either to the
+ * async flush-done callback or to the task blocked in draw_bitmap.
+ *
+ * @return true if a higher priority task was woken
+ */
+static bool IRAM_ATTR retire_xfer(st77916_panel_t *panel)
+{
+    BaseType_t woken = pdFALSE;
+    bool sched_woken = false;
 
-    g_io_handle = io_handle;
+    if (panel->inflight.head == panel->inflight.tail) {
+        return false;   // Not one of ours
+    }
+    xfer_t x = panel->inflight.ring[panel->inflight.head & (INFLIGHT_RING_SIZE - 1)];
+    panel->inflight.head++;
 
-    // Hardware reset
-    if (rst_gpio >= 0) {
-        gpio_config_t io_conf = {
-            .mode = GPIO_MODE_OUTPUT,
-            .pin_bit_mask = 1ULL << rst_gpio,
-        };
-        gpio_config(&io_conf);
+    // Bus time: from when this transfer could start until it finished
+    int64_t now = esp_timer_get_time();
+    int64_t start = (x.queued_us > panel->inflight.last_done_us) ? x.queued_us : panel->inflight.last_done_us;
+    panel->stats.xfer_us += now - start;
+    panel->inflight.last_done_us = now;
 
-        gpio_set_level(rst_gpio, 0);
-        vTaskDelay(pdMS_TO_TICKS(10));
-        gpio_set_level(rst_gpio, 1);
-        vTaskDelay(pdMS_TO_TICKS(120));
+    if (panel->sched) {
+        sched_woken = st77916_bus_sched_release(panel->sched);
+    }
+    if (x.buf) {
+        xQueueSendFromISR(panel->pool.free_q, &x.buf, &woken);
+    }
+    if (x.end_of_tile) {
+        panel->stats.tiles++;
+        if (panel->flush_done_cb) {
+            panel->flush_done_cb(panel->flush_done_ctx);
+        } else {
+            xSemaphoreGiveFromISR(panel->done_sem, &woken);
+        }
     }
+    return woken == pdTRUE || sched_woken;
+}
 
-    // Send initialization sequence using panel_io
-    size_t num_cmds = sizeof(init_sequence) / sizeof(init_cmd_t);
-    ESP_LOGI(TAG, "Sending %d init commands...", num_cmds);
+// Panel IO color transfer done callback (ISR context)
+static bool IRAM_ATTR color_trans_done(esp_lcd_panel_io_handle_t io,
+                                       esp_lcd_panel_io_event_data_t *edata,
+                                       void *user_ctx)
+{
+    return retire_xfer(user_ctx);
+}
 
-    for (size_t i = 0; i < num_cmds; i++) {
-        const init_cmd_t *cmd = &init_sequence[i];
-        ret = send_cmd(io_handle, cmd->cmd, cmd->data, cmd->len);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to send cmd 0x%02X", cmd->cmd);
-            return ret;
+// Direct SPI post-transaction callback: ISR for queued color transfers
+// (user is their panel), task context for polled commands (user is NULL)
+static void IRAM_ATTR direct_trans_done(spi_transaction_t *t)
+{
+    if (t->user && retire_xfer(t->user)) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief Build the visible span table
+ *
+ * With round set, row y shows columns [x0, x1) of the inscribed circle and
+ * edge pixels that are only partly inside the circle count as visible: the
+ * span is taken at the row's edge nearest the centre, where the circle is
+ * widest within the row.
+ * Otherwise every row is fully visible.
+ */
+static esp_err_t clip_init(st77916_panel_t *panel, int h_res, int v_res, bool round)
+{
+    if (panel->clip.row_vis) {
+        return ESP_OK;
+    }
+    if (h_res <= 0 || v_res <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    panel->clip.row_vis = heap_caps_malloc(v_res * sizeof(span_t), MALLOC_CAP_INTERNAL);
+    panel->clip.row_span = heap_caps_malloc(v_res * sizeof(span_t), MALLOC_CAP_INTERNAL);
+    panel->clip.bands = heap_caps_malloc(v_res * sizeof(band_t), MALLOC_CAP_INTERNAL);
+    if (!panel->clip.row_vis || !panel->clip.row_span || !panel->clip.bands) {
+        heap_caps_free(panel->clip.row_vis);
+        heap_caps_free(panel->clip.row_span);
+        heap_caps_free(panel->clip.bands);
+        panel->clip.row_vis = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    float cx = h_res / 2.0f;
+    float cy = v_res / 2.0f;
+    float r = ((h_res < v_res) ? h_res : v_res) / 2.0f;
+    for (int y = 0; y < v_res; y++) {
+        // Widest point of the circle within the row: its edge nearest the
+        // centre, or the centre itself if the row contains it
+        float dy = 0;
+        if (y > cy) {
+            dy = y - cy;
+        } else if (y + 1 < cy) {
+            dy = cy - (y + 1);
+        }
+        span_t *sp = &panel->clip.row_vis[y];
+        if (!round) {
+            sp->x0 = 0;
+            sp->x1 = h_res;
+            continue;
         }
-        if (cmd->delay_ms > 0) {
-            vTaskDelay(pdMS_TO_TICKS(cmd->delay_ms));
+        if (dy * dy >= r * r) {
+            sp->x0 = sp->x1 = 0;
+            continue;
         }
+        float half = sqrtf(r * r - dy * dy);
+        int x0 = (int)floorf(cx - half);
+        int x1 = (int)ceilf(cx + half);
+        sp->x0 = (x0 < 0) ? 0 : x0;
+        sp->x1 = (x1 > h_res) ? h_res : x1;
     }
 
-    ESP_LOGI(TAG, "ST77916 initialized (DIRECT SPI mode)");
+    panel->clip.h_res = h_res;
+    panel->clip.v_res = v_res;
+    panel->clip.round = round;
     return ESP_OK;
 }
 
-// Initialize direct SPI device for pixel data
-esp_err_t st77916_init_direct_spi(spi_host_device_t host, int cs_gpio, int freq_hz)
+// Allocate the shadow framebuffer; clip_init() must have run
+static esp_err_t shadow_init(st77916_panel_t *panel, uint8_t full_pct)
 {
-    ESP_LOGI(TAG, "Creating direct SPI device for pixel data...");
+    if (panel->shadow.fb) {
+        return ESP_OK;
+    }
 
-    spi_device_interface_config_t devcfg = {
-        .clock_speed_hz = freq_hz,
-        .mode = 0,
-        .spics_io_num = cs_gpio,
-        .queue_size = 7,
-        .flags = SPI_DEVICE_HALFDUPLEX,  // Start with just halfduplex
-        // Try adding SPI_DEVICE_BIT_LSBFIRST here if colors still wrong
-    };
+    size_t fb_size = (size_t)panel->clip.h_res * panel->clip.v_res * sizeof(uint16_t);
+    panel->shadow.fb = heap_caps_aligned_alloc(ST77916_DMA_ALIGN, fb_size, MALLOC_CAP_SPIRAM);
+    panel->shadow.row_valid = heap_caps_calloc(panel->clip.v_res, 1, MALLOC_CAP_INTERNAL);
+    if (!panel->shadow.fb || !panel->shadow.row_valid) {
+        ESP_LOGE(TAG, "Failed to allocate shadow framebuffer (%d bytes PSRAM)", fb_size);
+        heap_caps_free(panel->shadow.fb);
+        heap_caps_free(panel->shadow.row_valid);
+        panel->shadow.fb = NULL;
+        panel->shadow.row_valid = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    // Black until drawn: an early first frame may not cover every row
+    memset(panel->shadow.fb, 0, fb_size);
+    panel->shadow.full_pct = full_pct ? full_pct : SHADOW_FULL_PCT_DEFAULT;
+    ESP_LOGI(TAG, "Shadow framebuffer: %d bytes PSRAM", fb_size);
+    return ESP_OK;
+}
 
-    esp_err_t ret = spi_bus_add_device(host, &devcfg, &g_spi_device);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to add SPI device: %s", esp_err_to_name(ret));
-        return ret;
+// GRAM was written behind the shadow's back: resend every row in full
+static void shadow_invalidate(st77916_panel_t *panel)
+{
+    if (panel->shadow.row_valid) {
+        memset(panel->shadow.row_valid, 0, panel->clip.v_res);
+    }
+}
+
+/**
+ * @brief Recompute how many pixels fit one staging buffer in the current format
+ *
+ * Kept even so RGB444 pairs never straddle chunks and every RGB565 chunk
+ * after the first starts word aligned.
+ */
+static void update_chunk_pixels(st77916_panel_t *panel)
+{
+    panel->pool.chunk_pixels = ((panel->pool.buf_size * 8) / g_formats[panel->fmt].bits) & ~(size_t)1;
+}
+
+static void pack_append(pack_t *p, const uint16_t *src, size_t n)
+{
+    switch (p->fmt) {
+    case ST77916_PIXEL_RGB565:
+        // Byte-swap from ESP32 little-endian to display big-endian
+        st77916_swap565((uint16_t *)(p->buf + p->len), src, n);
+        p->len += n * sizeof(uint16_t);
+        break;
+    case ST77916_PIXEL_RGB666:
+        p->len += st77916_pack666(p->buf + p->len, src, n);
+        break;
+    case ST77916_PIXEL_RGB444:
+        if (p->carry && n > 0) {
+            uint16_t pair[2] = { p->carry_px, src[0] };
+            p->len += st77916_pack444(p->buf + p->len, pair, 2);
+            p->carry = false;
+            src++;
+            n--;
+        }
+        if (n & 1) {
+            p->carry = true;
+            p->carry_px = src[n - 1];
+            n--;
+        }
+        p->len += st77916_pack444(p->buf + p->len, src, n);
+        break;
+    }
+}
+
+// Flush a carried RGB444 pixel at the end of a window
+static void pack_finish(pack_t *p)
+{
+    if (p->carry) {
+        p->len += st77916_pack444(p->buf + p->len, &p->carry_px, 1);
+        p->carry = false;
     }
+}
 
-    ESP_LOGI(TAG, "Direct SPI device created");
+/**
+ * @brief Collect completed direct SPI transactions
+ *
+ * The post callback already retired them; this only returns descriptors.
+ *
+ * @param wait Ticks to wait for the first result, 0 to collect what is done
+ */
+static esp_err_t direct_reap(st77916_panel_t *panel, TickType_t wait)
+{
+    spi_transaction_t *done;
+    while (panel->direct.queued > 0) {
+        esp_err_t ret = spi_device_get_trans_result(panel->direct.dev, &done, wait);
+        if (ret == ESP_ERR_TIMEOUT) {
+            return ESP_OK;
+        }
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        panel->direct.queued--;
+        wait = 0;
+    }
     return ESP_OK;
 }
 
-// Send command byte (single-line SPI, then QSPI for params)
-static esp_err_t direct_send_cmd(uint8_t cmd, const uint8_t *data, size_t len)
+// Wait for every queued direct SPI transaction to finish
+static esp_err_t direct_drain(st77916_panel_t *panel)
 {
-    if (!g_spi_device) {
-        // Fall back to panel_io if direct SPI not set up
-        if (g_io_handle) {
-            return send_cmd(g_io_handle, cmd, data, len);
+    while (panel->direct.queued > 0) {
+        esp_err_t ret = direct_reap(panel, portMAX_DELAY);
+        if (ret != ESP_OK) {
+            return ret;
         }
+    }
+    return ESP_OK;
+}
+
+// Helper to send a command (init sequence and address window). On either
+// transport it is a polled transaction that first drains any queued color
+// transfers, so it always lands behind the pixels already in flight.
+static esp_err_t send_cmd(st77916_panel_t *panel, uint8_t cmd, const uint8_t *data, size_t len)
+{
+    panel->stats.transactions++;
+    panel->stats.cmd_bytes += QSPI_HEADER_BYTES + len;
+
+    if (panel->transport == ST77916_TRANSPORT_PANEL_IO) {
+        int lcd_cmd = (QSPI_CMD_WRITE_CMD << 24) | (cmd << 8);
+        return esp_lcd_panel_io_tx_param(panel->io, lcd_cmd, data, len);
+    }
+    if (panel->transport != ST77916_TRANSPORT_DIRECT_SPI) {
         return ESP_ERR_INVALID_STATE;
     }
 
-    // Build QSPI command frame: opcode (0x02) + 24-bit address with cmd
-    // Format: [opcode 8-bit][addr 24-bit] sent on single line
-    // For write command: opcode=0x02, addr = cmd << 8
+    // Polled transactions may not overlap queued ones on the same device.
+    // Like tx_param(), this lets queued pixels finish first.
+    esp_err_t ret = direct_drain(panel);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Opcode 0x02 + 24-bit address holding the command, all on one line.
+    // Short parameter lists ride in the descriptor instead of a DMA buffer.
     spi_transaction_ext_t t = {
         .base = {
             .flags = SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_ADDR,
             .cmd = QSPI_CMD_WRITE_CMD,
             .addr = cmd << 8,
             .length = len * 8,
-            .tx_buffer = (len > 0) ? data : NULL,
         },
         .command_bits = 8,
         .address_bits = 24,
     };
-
-    return spi_device_transmit(g_spi_device, (spi_transaction_t *)&t);
+    if (len <= sizeof(t.base.tx_data)) {
+        t.base.flags |= SPI_TRANS_USE_TXDATA;
+        if (len > 0) {
+            memcpy(t.base.tx_data, data, len);
+        }
+    } else {
+        t.base.tx_buffer = data;
+    }
+    return spi_device_polling_transmit(panel->direct.dev, (spi_transaction_t *)&t);
 }
 
-esp_err_t st77916_panel_draw_bitmap(esp_lcd_panel_io_handle_t io_handle,
-                                     int x_start, int y_start,
-                                     int x_end, int y_end,
-                                     const void *color_data)
+// Hand one color transfer to the transport, without bus scheduling
+static esp_err_t send_color_queue(st77916_panel_t *panel, uint8_t ramwr, const void *data, size_t len)
 {
-    esp_err_t ret;
+    if (panel->transport == ST77916_TRANSPORT_PANEL_IO) {
+        int lcd_cmd = (QSPI_CMD_WRITE_COLOR << 24) | (ramwr << 8);
+        return esp_lcd_panel_io_tx_color(panel->io, lcd_cmd, data, len);
+    }
 
-    // Set column address (CASET)
-    uint8_t caset_data[] = {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    };
-    ret = send_cmd(io_handle, LCD_CMD_CASET, caset_data, 4);
-    if (ret != ESP_OK) return ret;
+    // Collect finished descriptors; block only if all are still queued
+    direct_reap(panel, 0);
+    while (panel->direct.queued >= DIRECT_QUEUE_SIZE) {
+        esp_err_t ret = direct_reap(panel, portMAX_DELAY);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
 
-    // Set row address (RASET)
-    uint8_t raset_data[] = {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
+    // Opcode 0x32 + address on one line, pixels on four
+    spi_transaction_ext_t *t = &panel->direct.trans[panel->direct.next % DIRECT_QUEUE_SIZE];
+    *t = (spi_transaction_ext_t) {
+        .base = {
+            .flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_ADDR,
+            .cmd = QSPI_CMD_WRITE_COLOR,
+            .addr = ramwr << 8,
+            .length = len * 8,
+            .tx_buffer = data,
+            .user = panel,
+        },
+        .command_bits = 8,
+        .address_bits = 24,
     };
-    ret = send_cmd(io_handle, LCD_CMD_RASET, raset_data, 4);
-    if (ret != ESP_OK) return ret;
-
-    // Calculate pixel count and data size
-    size_t num_pixels = (x_end - x_start) * (y_end - y_start);
-    size_t data_len = num_pixels * 2;  // RGB565 = 2 bytes per pixel
-
-    // Allocate buffer for byte-swapped pixels
-    uint16_t *swapped_buf = heap_caps_malloc(data_len, MALLOC_CAP_DMA);
-    if (!swapped_buf) {
-        ESP_LOGE(TAG, "Failed to allocate byte-swap buffer");
-        return ESP_ERR_NO_MEM;
+    esp_err_t ret = spi_device_queue_trans(panel->direct.dev, (spi_transaction_t *)t, portMAX_DELAY);
+    if (ret != ESP_OK) {
+        return ret;
     }
+    panel->direct.next++;
+    panel->direct.queued++;
+    return ESP_OK;
+}
 
-    // Apply byte-swap to convert from ESP32 little-endian to display big-endian
-    swap_bytes_buffer(swapped_buf, (const uint16_t *)color_data, num_pixels);
-
-    // Send RAMWR command + pixel data using panel_io tx_color
-    int lcd_cmd = (QSPI_CMD_WRITE_COLOR << 24) | (LCD_CMD_RAMWR << 8);
-    ret = esp_lcd_panel_io_tx_color(io_handle, lcd_cmd, swapped_buf, data_len);
-
-    // Wait for DMA transfer to complete before freeing buffer
-    vTaskDelay(1);
+/**
+ * @brief Queue a color transfer on the active transport
+ *
+ * The caller has already recorded it with inflight_push(); completion is
+ * reported through retire_xfer().
+ */
+static esp_err_t send_color(st77916_panel_t *panel, uint8_t ramwr, const void *data, size_t len)
+{
+    panel->stats.transactions++;
+    panel->stats.cmd_bytes += QSPI_HEADER_BYTES;
 
-    heap_caps_free(swapped_buf);
+    if (panel->transport != ST77916_TRANSPORT_PANEL_IO &&
+        panel->transport != ST77916_TRANSPORT_DIRECT_SPI) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // On a shared bus, wait for this panel's turn; the slot is handed back
+    // from retire_xfer() once the transfer completes
+    if (panel->sched) {
+        st77916_bus_sched_acquire(panel->sched, panel->sched_client, len);
+    }
+    esp_err_t ret = send_color_queue(panel, ramwr, data, len);
+    if (ret != ESP_OK && panel->sched) {
+        st77916_bus_sched_release(panel->sched);
+    }
     return ret;
 }
 
-// Alternative draw function using direct SPI (call this instead if panel_io has issues)
-esp_err_t st77916_panel_draw_bitmap_direct(int x_start, int y_start,
-                                            int x_end, int y_end,
-                                            const void *color_data)
-{
-    esp_err_t ret;
+static esp_err_t set_window(st77916_panel_t *panel, int x_start, int y_start, int x_end, int y_end);
+static esp_err_t stream_pixels(st77916_panel_t *panel, const uint16_t *src, size_t stride,
+                               size_t w, size_t h, bool end_of_tile);
 
-    if (!g_spi_device) {
-        ESP_LOGE(TAG, "Direct SPI not initialized - call st77916_init_direct_spi first");
-        return ESP_ERR_INVALID_STATE;
+static void bringup_phase(st77916_panel_t *panel, st77916_bringup_phase_t phase)
+{
+    if (panel->bringup.on_phase) {
+        panel->bringup.on_phase(phase, panel->bringup.user_ctx);
     }
+}
 
-    // Set column address (CASET)
-    uint8_t caset_data[] = {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    };
-    ret = direct_send_cmd(LCD_CMD_CASET, caset_data, 4);
-    if (ret != ESP_OK) return ret;
+/**
+ * @brief Send the whole shadow framebuffer to GRAM and wait for it
+ *
+ * Runs before DISPON, so the display comes on showing the frame the app
+ * drew while the panel was still starting.
+ */
+static esp_err_t push_shadow(st77916_panel_t *panel)
+{
+    // Sync mode for this one transfer: retire_xfer() gives panel->done_sem
+    st77916_flush_done_cb_t saved_cb = panel->flush_done_cb;
+    panel->flush_done_cb = NULL;
 
-    // Set row address (RASET)
-    uint8_t raset_data[] = {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    };
-    ret = direct_send_cmd(LCD_CMD_RASET, raset_data, 4);
-    if (ret != ESP_OK) return ret;
+    esp_err_t ret = set_window(panel, 0, 0, panel->clip.h_res, panel->clip.v_res);
+    if (ret == ESP_OK) {
+        ret = stream_pixels(panel, panel->shadow.fb, panel->clip.h_res, panel->clip.h_res, panel->clip.v_res, true);
+    }
+    if (ret == ESP_OK) {
+        xSemaphoreTake(panel->done_sem, portMAX_DELAY);
+        memset(panel->shadow.row_valid, 1, panel->clip.v_res);
+    }
+    panel->flush_done_cb = saved_cb;
+    return ret;
+}
 
-    // Send RAMWR command with pixel data directly via SPI
-    // Using opcode 0x32 for quad write + RAMWR (0x2C) command
-    size_t num_pixels = (x_end - x_start) * (y_end - y_start);
-    size_t data_len = num_pixels * 2;
+/**
+ * @brief Stream RLE565 pixels into GRAM through the staging buffers
+ *
+ * Like stream_pixels(), but the source is decompressed a slice at a time
+ * straight into each staging buffer, so the image never exists
+ * uncompressed in RAM. A short stream is padded with black.
+ */
+static esp_err_t stream_rle565(st77916_panel_t *panel, st77916_rle565_t *dec, size_t num_pixels)
+{
+    uint16_t slice[RLE_SLICE_PIXELS];
+    uint8_t ramwr = LCD_CMD_RAMWR;
+    size_t sent = 0;
+    size_t missing = 0;
+    while (sent < num_pixels) {
+        pack_t pack = { .buf = pool_acquire(panel), .fmt = panel->fmt };
+        size_t fill = 0;
+        while (fill < panel->pool.chunk_pixels && sent + fill < num_pixels) {
+            size_t n = num_pixels - sent - fill;
+            if (n > panel->pool.chunk_pixels - fill) {
+                n = panel->pool.chunk_pixels - fill;
+            }
+            if (n > RLE_SLICE_PIXELS) {
+                n = RLE_SLICE_PIXELS;
+            }
+            size_t got = st77916_rle565_decode(dec, slice, n);
+            if (got < n) {
+                memset(&slice[got], 0, (n - got) * sizeof(uint16_t));
+                missing += n - got;
+            }
+            pack_append(&pack, slice, n);
+            fill += n;
+        }
+        sent += fill;
+        if (sent == num_pixels) {
+            pack_finish(&pack);
+        }
 
-    ESP_LOGD(TAG, "Direct SPI: sending %d pixels (%d bytes)", num_pixels, data_len);
+        size_t len = pack.len;
+        inflight_push(panel, pack.buf, sent == num_pixels);
+        esp_err_t ret = send_color(panel, ramwr, pack.buf, len);
+        if (ret != ESP_OK) {
+            inflight_unpush(panel);
+            xQueueSend(panel->pool.free_q, &pack.buf, 0);
+            return ret;
+        }
+        panel->stats.chunks++;
+        panel->stats.bytes_sent += len;
 
-    // Build transaction with QSPI command header + raw pixel data
-    spi_transaction_ext_t t = {
-        .base = {
-            .flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_ADDR,
-            .cmd = QSPI_CMD_WRITE_COLOR,  // 0x32 - quad write
-            .addr = LCD_CMD_RAMWR << 8,   // 0x2C shifted
-            .length = data_len * 8,        // Data length in bits
-            .tx_buffer = color_data,
-        },
-        .command_bits = 8,
-        .address_bits = 24,
-    };
+        ramwr = LCD_CMD_RAMWRC;
+    }
+    if (missing) {
+        ESP_LOGW(TAG, "RLE565 image %d pixels short", missing);
+    }
+    return ESP_OK;
+}
 
-    ret = spi_device_transmit(g_spi_device, (spi_transaction_t *)&t);
+// Write an RLE565 image to GRAM and wait until it is there
+static esp_err_t write_rle565(st77916_panel_t *panel, int x_start, int y_start,
+                              const st77916_splash_t *image)
+{
+    st77916_flush_done_cb_t saved_cb = panel->flush_done_cb;
+    panel->flush_done_cb = NULL;
 
+    st77916_rle565_t dec;
+    st77916_rle565_init(&dec, image->rle, image->rle_len);
+    esp_err_t ret = set_window(panel, x_start, y_start, x_start + image->w, y_start + image->h);
+    if (ret == ESP_OK) {
+        ret = stream_rle565(panel, &dec, (size_t)image->w * image->h);
+    }
+    if (ret == ESP_OK) {
+        xSemaphoreTake(panel->done_sem, portMAX_DELAY);
+    }
+    panel->flush_done_cb = saved_cb;
+    // GRAM no longer matches the shadow
+    shadow_invalidate(panel);
     return ret;
 }
 
-// NEW: Draw using manufacturer's command format (0x3C RAMWRC)
-// This matches how the STM32 manufacturer code sends pixel data
-esp_err_t st77916_panel_draw_bitmap_mfr(esp_lcd_panel_io_handle_t io_handle,
-                                         int x_start, int y_start,
-                                         int x_end, int y_end,
-                                         const void *color_data)
+/**
+ * @brief Bring the panel up: reset, init sequence, first frame, DISPON
+ *
+ * The reset and SLPOUT waits are plain task delays, so on the async path
+ * the app keeps running through them. Draws arriving meanwhile land in
+ * the shadow framebuffer (or wait, without one); the shadow is pushed to
+ * GRAM while the display is still off and only then is DISPON sent. If no
+ * frame was drawn yet, the splash image (if any) is written instead.
+ */
+static esp_err_t bringup_run(st77916_panel_t *panel)
 {
-    esp_err_t ret;
+    esp_err_t ret = ESP_OK;
 
-    // Set column address (CASET) - using standard 0x02 write opcode
-    uint8_t caset_data[] = {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
+    // Hardware reset
+    bringup_phase(panel, ST77916_BRINGUP_RESET);
+    if (panel->bringup.rst_gpio >= 0) {
+        gpio_config_t io_conf = {
+            .mode = GPIO_MODE_OUTPUT,
+            .pin_bit_mask = 1ULL << panel->bringup.rst_gpio,
+        };
+        gpio_config(&io_conf);
+
+        gpio_set_level(panel->bringup.rst_gpio, 0);
+        vTaskDelay(pdMS_TO_TICKS(10));
+        gpio_set_level(panel->bringup.rst_gpio, 1);
+        vTaskDelay(pdMS_TO_TICKS(120));
+    }
+
+    // Send the manufacturer's initialization sequence, holding back DISPON
+    bringup_phase(panel, ST77916_BRINGUP_INIT_CMDS);
+    ESP_LOGI(TAG, "Sending %d init commands...", ST77916_INIT_CMD_COUNT);
+
+    const uint8_t *pos = st77916_init_stream;
+    const uint8_t *next;
+    st77916_init_cmd_t cmd;
+    while ((next = st77916_init_cmd_next(pos, &cmd)) != NULL && cmd.cmd != LCD_CMD_DISPON) {
+        ret = send_cmd(panel, cmd.cmd, cmd.data, cmd.len);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to send cmd 0x%02X", cmd.cmd);
+            return ret;
+        }
+        if (cmd.delay_ms > 0) {
+            if (cmd.cmd == LCD_CMD_SLPOUT) {
+                bringup_phase(panel, ST77916_BRINGUP_SLEEP_OUT);
+            }
+            vTaskDelay(pdMS_TO_TICKS(cmd.delay_ms));
+        }
+        pos = next;
+    }
+
+    // The init sequence selects RGB565; switch if configured otherwise
+    if (panel->fmt != ST77916_PIXEL_RGB565) {
+        ret = send_cmd(panel, LCD_CMD_COLMOD, &g_formats[panel->fmt].colmod, 1);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to set COLMOD");
+            return ret;
+        }
+    }
+
+    // From here on draws go straight to the bus
+    xSemaphoreTake(panel->bringup.lock, portMAX_DELAY);
+    if (panel->bringup.frame_pending) {
+        ret = push_shadow(panel);
+        if (ret == ESP_OK) {
+            bringup_phase(panel, ST77916_BRINGUP_FIRST_FRAME);
+        }
+    } else if (panel->bringup.splash) {
+        const st77916_splash_t *splash = panel->bringup.splash;
+        ret = write_rle565(panel, (panel->h_res - splash->w) / 2, (panel->v_res - splash->h) / 2, splash);
+        if (ret == ESP_OK) {
+            bringup_phase(panel, ST77916_BRINGUP_SPLASH);
+        }
+    }
+    while (ret == ESP_OK && (next = st77916_init_cmd_next(pos, &cmd)) != NULL) {
+        ret = send_cmd(panel, cmd.cmd, cmd.data, cmd.len);
+        if (ret == ESP_OK && cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(cmd.delay_ms));
+        }
+        pos = next;
+    }
+    if (ret == ESP_OK) {
+        panel->bringup.ready = true;
+    }
+    xSemaphoreGive(panel->bringup.lock);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Panel bring-up failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    bringup_phase(panel, ST77916_BRINGUP_READY);
+    return ESP_OK;
+}
+
+// Record the bring-up outcome for st77916_panel_wait_ready()
+static esp_err_t bringup_finish(st77916_panel_t *panel, esp_err_t ret)
+{
+    panel->bringup.result = ret;
+    xEventGroupSetBits(panel->bringup.events, BRINGUP_DONE_BIT);
+    if (ret != ESP_OK) {
+        bringup_phase(panel, ST77916_BRINGUP_FAILED);
+    }
+    return ret;
+}
+
+static void bringup_task(void *arg)
+{
+    st77916_panel_t *panel = arg;
+
+    if (bringup_finish(panel, bringup_run(panel)) == ESP_OK) {
+        ESP_LOGI(TAG, "ST77916 initialized (%s transport)",
+                 (panel->transport == ST77916_TRANSPORT_PANEL_IO) ? "panel IO" : "direct SPI");
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t st77916_panel_wait_ready(st77916_panel_handle_t panel, TickType_t timeout)
+{
+    if (!panel) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (panel->bringup.ready) {
+        return ESP_OK;
+    }
+    if (!panel->bringup.events) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    EventBits_t bits = xEventGroupWaitBits(panel->bringup.events, BRINGUP_DONE_BIT,
+                                           pdFALSE, pdTRUE, timeout);
+    if (!(bits & BRINGUP_DONE_BIT)) {
+        return ESP_ERR_TIMEOUT;
+    }
+    return panel->bringup.result;
+}
+
+static esp_err_t bringup_wait(st77916_panel_t *panel)
+{
+    return st77916_panel_wait_ready(panel, portMAX_DELAY);
+}
+
+/**
+ * @brief Release whatever st77916_panel_new() built before it failed
+ *
+ * Members still NULL were never created. Transfers already queued retire
+ * through this panel and read its staging buffers, so they finish first.
+ */
+static void panel_free(st77916_panel_t *panel)
+{
+    if (panel->direct.dev) {
+        direct_drain(panel);
+        spi_bus_remove_device(panel->direct.dev);
+    }
+    if (panel->io) {
+        while (panel->inflight.head != panel->inflight.tail) {
+            vTaskDelay(1);
+        }
+        const esp_lcd_panel_io_callbacks_t no_cbs = {0};
+        esp_lcd_panel_io_register_event_callbacks(panel->io, &no_cbs, NULL);
+    }
+    if (panel->sched) {
+        st77916_bus_sched_remove_client(panel->sched, panel->sched_client);
+    }
+    if (panel->bringup.events) {
+        vEventGroupDelete(panel->bringup.events);
+    }
+    if (panel->bringup.lock) {
+        vSemaphoreDelete(panel->bringup.lock);
+    }
+    if (panel->done_sem) {
+        vSemaphoreDelete(panel->done_sem);
+    }
+    heap_caps_free(panel->shadow.fb);
+    heap_caps_free(panel->shadow.row_valid);
+    heap_caps_free(panel->clip.row_vis);
+    heap_caps_free(panel->clip.row_span);
+    heap_caps_free(panel->clip.bands);
+    for (int i = 0; i < ST77916_POOL_MAX_BUFS; i++) {
+        heap_caps_free(panel->pool.bufs[i]);
+    }
+    if (panel->pool.free_q) {
+        vQueueDelete(panel->pool.free_q);
+    }
+    heap_caps_free(panel);
+}
+
+esp_err_t st77916_panel_new(esp_lcd_panel_io_handle_t io_handle, const st77916_panel_config_t *config,
+                            st77916_panel_handle_t *ret_panel)
+{
+    esp_err_t ret;
+
+    if (!config || !ret_panel || (config->transport == ST77916_TRANSPORT_PANEL_IO && !io_handle)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->pixel_format >= sizeof(g_formats) / sizeof(g_formats[0])) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->splash && (!config->splash->rle ||
+                           config->splash->w > config->h_res || config->splash->h > config->v_res)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ESP_LOGI(TAG, "Initializing ST77916 with DIRECT SPI driver...");
+
+    // Touched from the transfer-done ISR, so keep it out of PSRAM
+    st77916_panel_t *panel = heap_caps_calloc(1, sizeof(st77916_panel_t), MALLOC_CAP_INTERNAL);
+    if (!panel) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    panel->win.caset_valid = panel->win.raset_valid = false;
+    panel->h_res = config->h_res;
+    panel->v_res = config->v_res;
+    panel->direct.host = config->spi_host;
+    panel->direct.cs_gpio = config->cs_gpio;
+    panel->direct.pclk_hz = config->pclk_hz;
+    panel->fmt = config->pixel_format;
+
+    // Size staging buffers for one chunk, or for the largest tile LVGL will
+    // hand us (in the configured format) when streaming is off
+    size_t buf_size = fmt_bytes(panel, config->max_tile_pixels);
+    if (config->chunk_bytes > 0 && config->chunk_bytes < buf_size) {
+        buf_size = config->chunk_bytes;
+    }
+    ret = pool_init(panel, buf_size, config->pool_bufs);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Staging pool init failed: %s", esp_err_to_name(ret));
+        goto err;
+    }
+    update_chunk_pixels(panel);
+    if (panel->pool.chunk_pixels == 0) {
+        ret = ESP_ERR_INVALID_ARG;
+        goto err;
+    }
+
+    if (config->round_clip || config->shadow_fb) {
+        ret = clip_init(panel, config->h_res, config->v_res, config->round_clip);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Row span table init failed: %s", esp_err_to_name(ret));
+            goto err;
+        }
+        panel->clip.enabled = true;
+    }
+    if (config->shadow_fb) {
+        ret = shadow_init(panel, config->shadow_full_pct);
+        if (ret != ESP_OK) {
+            goto err;
+        }
+    }
+    // GRAM holds garbage after reset
+    shadow_invalidate(panel);
+
+    // Completion-driven transfers: the ISR retires each color transaction
+    panel->done_sem = xSemaphoreCreateBinary();
+    if (!panel->done_sem) {
+        ret = ESP_ERR_NO_MEM;
+        goto err;
+    }
+    panel->flush_done_cb = config->on_flush_done;
+    panel->flush_done_ctx = config->user_ctx;
+
+    if (config->bus_sched) {
+        ret = st77916_bus_sched_add_client(config->bus_sched, config->bus_weight,
+                                           &panel->sched_client);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Bus scheduler registration failed: %s", esp_err_to_name(ret));
+            goto err;
+        }
+        panel->sched = config->bus_sched;
+    }
+
+    ret = st77916_panel_set_transport(panel, io_handle, config->transport);
+    if (ret != ESP_OK) {
+        goto err;
+    }
+
+    panel->bringup.rst_gpio = config->rst_gpio;
+    panel->bringup.on_phase = config->on_bringup;
+    panel->bringup.splash = config->splash;
+    panel->bringup.user_ctx = config->user_ctx;
+    panel->bringup.events = xEventGroupCreate();
+    panel->bringup.lock = xSemaphoreCreateMutex();
+    if (!panel->bringup.events || !panel->bringup.lock) {
+        ret = ESP_ERR_NO_MEM;
+        goto err;
+    }
+
+    if (config->async_init) {
+        if (xTaskCreate(bringup_task, "st77916_up", BRINGUP_TASK_STACK, panel,
+                        BRINGUP_TASK_PRIORITY, NULL) != pdPASS) {
+            ret = ESP_ERR_NO_MEM;
+            goto err;
+        }
+        // A failure from here on is reported by st77916_panel_wait_ready()
+        *ret_panel = panel;
+        return ESP_OK;
+    }
+    ret = bringup_finish(panel, bringup_run(panel));
+    if (ret != ESP_OK) {
+        goto err;
+    }
+
+    ESP_LOGI(TAG, "ST77916 initialized (%s transport)",
+             (panel->transport == ST77916_TRANSPORT_PANEL_IO) ? "panel IO" : "direct SPI");
+    *ret_panel = panel;
+    return ESP_OK;
+
+err:
+    panel_free(panel);
+    return ret;
+}
+
+/**
+ * @brief Set the GRAM address window, end coordinates exclusive
+ *
+ * The panel keeps CASET/RASET across RAMWR (which restarts at the window
+ * origin), so either command is skipped when it matches the last one sent,
+ * e.g. consecutive full-width tiles only need RASET.
+ */
+static esp_err_t set_window(st77916_panel_t *panel, int x_start, int y_start, int x_end, int y_end)
+{
+    esp_err_t ret;
+
+    // Set column address (CASET)
+    uint8_t caset_data[] = {
+        (x_start >> 8) & 0xFF,
+        x_start & 0xFF,
+        ((x_end - 1) >> 8) & 0xFF,
+        (x_end - 1) & 0xFF,
     };
-    ret = send_cmd(io_handle, LCD_CMD_CASET, caset_data, 4);
-    if (ret != ESP_OK) return ret;
+    if (panel->win.caset_valid && memcmp(panel->win.caset, caset_data, 4) == 0) {
+        panel->stats.window_cmds_skipped++;
+    } else {
+        panel->win.caset_valid = false;  // Unknown column range if the command fails
+        ret = send_cmd(panel, LCD_CMD_CASET, caset_data, 4);
+        if (ret != ESP_OK) return ret;
+        memcpy(panel->win.caset, caset_data, 4);
+        panel->win.caset_valid = true;
+    }
 
     // Set row address (RASET)
     uint8_t raset_data[] = {
@@ -520,11 +1100,592 @@ esp_err_t st77916_panel_draw_bitmap_mfr(esp_lcd_panel_io_handle_t io_handle,
         ((y_end - 1) >> 8) & 0xFF,
         (y_end - 1) & 0xFF,
     };
-    ret = send_cmd(io_handle, LCD_CMD_RASET, raset_data, 4);
+    if (panel->win.raset_valid && memcmp(panel->win.raset, raset_data, 4) == 0) {
+        panel->stats.window_cmds_skipped++;
+    } else {
+        panel->win.raset_valid = false;
+        ret = send_cmd(panel, LCD_CMD_RASET, raset_data, 4);
+        if (ret != ESP_OK) return ret;
+        memcpy(panel->win.raset, raset_data, 4);
+        panel->win.raset_valid = true;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Stream a w x h block of source pixels into the current window
+ *
+ * Rows are gathered from src with the given stride (in pixels) and streamed
+ * in chunks: the first opens the window with RAMWR, the rest continue it with
+ * RAMWRC. tx_color() only queues the transfer, so swapping chunk k+1 runs
+ * while chunk k is on the bus; pool_acquire() blocks once every staging
+ * buffer is in flight.
+ *
+ * @param end_of_tile Mark the final chunk as the end of the draw_bitmap call
+ */
+static esp_err_t stream_pixels(st77916_panel_t *panel, const uint16_t *src, size_t stride,
+                               size_t w, size_t h, bool end_of_tile)
+{
+    // Contiguous rows are one long run
+    if (w == stride) {
+        w *= h;
+        stride = w;
+        h = 1;
+    }
+
+    uint8_t ramwr = LCD_CMD_RAMWR;
+    size_t row = 0;
+    size_t col = 0;
+    while (row < h) {
+        // Take a pre-allocated DMA buffer and convert pixels into it
+        pack_t pack = { .buf = pool_acquire(panel), .fmt = panel->fmt };
+        size_t fill = 0;
+        while (fill < panel->pool.chunk_pixels && row < h) {
+            size_t n = w - col;
+            if (n > panel->pool.chunk_pixels - fill) {
+                n = panel->pool.chunk_pixels - fill;
+            }
+            pack_append(&pack, src + row * stride + col, n);
+            fill += n;
+            col += n;
+            if (col == w) {
+                col = 0;
+                row++;
+            }
+        }
+        if (row == h) {
+            pack_finish(&pack);
+        }
+
+        // The staging buffer is recycled by color_trans_done() once DMA finishes
+        size_t len = pack.len;
+        inflight_push(panel, pack.buf, end_of_tile && row == h);
+        esp_err_t ret = send_color(panel, ramwr, pack.buf, len);
+        if (ret != ESP_OK) {
+            inflight_unpush(panel);
+            xQueueSend(panel->pool.free_q, &pack.buf, 0);
+            return ret;
+        }
+        panel->stats.chunks++;
+        panel->stats.bytes_sent += len;
+
+        ramwr = LCD_CMD_RAMWRC;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Merge per-row spans into rectangular bands
+ *
+ * Consecutive non-empty rows share a band (one CASET/RASET/RAMWR window)
+ * as long as no row in it is padded by more than CLIP_BAND_SLACK_PX. Each
+ * extra window also drains the transfer pipeline, so bands are kept few.
+ *
+ * @return Number of bands written to panel->clip.bands
+ */
+static size_t merge_bands(st77916_panel_t *panel, const span_t *rows, int y_start, int num_rows)
+{
+    size_t n = 0;
+    band_t *cur = NULL;
+    int min_w = 0;
+
+    for (int i = 0; i < num_rows; i++) {
+        const span_t *sp = &rows[i];
+        int w = sp->x1 - sp->x0;
+        if (w <= 0) {
+            cur = NULL;
+            continue;
+        }
+        if (cur) {
+            int x0 = (sp->x0 < cur->x0) ? sp->x0 : cur->x0;
+            int x1 = (sp->x1 > cur->x1) ? sp->x1 : cur->x1;
+            int narrowest = (w < min_w) ? w : min_w;
+            if ((x1 - x0) - narrowest <= CLIP_BAND_SLACK_PX) {
+                cur->x0 = x0;
+                cur->x1 = x1;
+                cur->y1 = y_start + i + 1;
+                min_w = narrowest;
+                continue;
+            }
+        }
+        cur = &panel->clip.bands[n++];
+        cur->x0 = sp->x0;
+        cur->x1 = sp->x1;
+        cur->y0 = y_start + i;
+        cur->y1 = y_start + i + 1;
+        min_w = w;
+    }
+    return n;
+}
+
+// Fill panel->clip.row_span with the visible part of each tile row
+static size_t clip_row_spans(st77916_panel_t *panel, int x_start, int y_start, int x_end, int y_end)
+{
+    size_t vis_px = 0;
+    for (int y = y_start; y < y_end; y++) {
+        const span_t *vis = &panel->clip.row_vis[y];
+        span_t *sp = &panel->clip.row_span[y - y_start];
+        sp->x0 = (vis->x0 > x_start) ? vis->x0 : x_start;
+        sp->x1 = (vis->x1 < x_end) ? vis->x1 : x_end;
+        if (sp->x1 > sp->x0) {
+            vis_px += sp->x1 - sp->x0;
+        }
+    }
+    return vis_px;
+}
+
+/**
+ * @brief Narrow each row span to the pixels that differ from the shadow
+ *
+ * Each row keeps a single span from its first to its last changed pixel;
+ * rows with no change become empty. The shadow is updated with the new
+ * pixels as it goes, so it matches the tile whether or not the narrowed
+ * spans are used.
+ *
+ * @return Number of changed pixels (sum of the narrowed spans)
+ */
+static size_t shadow_diff(st77916_panel_t *panel, const uint16_t *src, int x_start, int y_start, int tile_w, int tile_h)
+{
+    size_t changed_px = 0;
+
+    for (int i = 0; i < tile_h; i++) {
+        span_t *sp = &panel->clip.row_span[i];
+        if (sp->x1 <= sp->x0) {
+            continue;
+        }
+        int y = y_start + i;
+        size_t n = sp->x1 - sp->x0;
+        const uint16_t *a = src + i * tile_w + (sp->x0 - x_start);
+        uint16_t *b = panel->shadow.fb + y * panel->clip.h_res + sp->x0;
+
+        if (!panel->shadow.row_valid[y]) {
+            // GRAM contents unknown: send the whole span
+            memcpy(b, a, n * sizeof(uint16_t));
+            const span_t *vis = &panel->clip.row_vis[y];
+            panel->shadow.row_valid[y] = (sp->x0 == vis->x0 && sp->x1 == vis->x1);
+            changed_px += n;
+            continue;
+        }
+
+        size_t first = st77916_diff565_first(a, b, n);
+        if (first == n) {
+            sp->x1 = sp->x0;
+            continue;
+        }
+        size_t last = first + st77916_diff565_last(a + first, b + first, n - first);
+        memcpy(b + first, a + first, (last - first) * sizeof(uint16_t));
+        sp->x1 = sp->x0 + last;
+        sp->x0 += first;
+        changed_px += last - first;
+    }
+    return changed_px;
+}
+
+// A tile that needs no transfer is complete as soon as it is accepted
+static void tile_done_now(st77916_panel_t *panel)
+{
+    panel->stats.tiles++;
+    if (panel->flush_done_cb) {
+        panel->flush_done_cb(panel->flush_done_ctx);
+    }
+}
+
+/**
+ * @brief Accept a tile while the panel is still being brought up
+ *
+ * With a shadow framebuffer the tile is copied there and pushed to GRAM as
+ * part of the first frame; without one the caller waits for bring-up.
+ *
+ * @return true if the tile was absorbed and is already complete
+ */
+static bool draw_before_ready(st77916_panel_t *panel, const uint16_t *src, int x_start, int y_start,
+                              size_t tile_w, size_t tile_h, esp_err_t *ret)
+{
+    *ret = ESP_OK;
+    if (!panel->shadow.fb) {
+        *ret = bringup_wait(panel);
+        return *ret != ESP_OK;
+    }
+
+    xSemaphoreTake(panel->bringup.lock, portMAX_DELAY);
+    if (panel->bringup.ready) {
+        xSemaphoreGive(panel->bringup.lock);
+        return false;
+    }
+    for (size_t y = 0; y < tile_h; y++) {
+        memcpy(&panel->shadow.fb[(y_start + y) * panel->clip.h_res + x_start],
+               &src[y * tile_w], tile_w * sizeof(uint16_t));
+    }
+    panel->bringup.frame_pending = true;
+    xSemaphoreGive(panel->bringup.lock);
+
+    tile_done_now(panel);
+    return true;
+}
+
+esp_err_t st77916_panel_draw_bitmap(st77916_panel_handle_t panel,
+                                     int x_start, int y_start,
+                                     int x_end, int y_end,
+                                     const void *color_data)
+{
+    esp_err_t ret;
+    const uint16_t *src = (const uint16_t *)color_data;
+    size_t tile_w = x_end - x_start;
+    size_t tile_h = y_end - y_start;
+
+    if (!panel->bringup.ready &&
+        draw_before_ready(panel, src, x_start, y_start, tile_w, tile_h, &ret)) {
+        return ret;
+    }
+
+    if (!panel->clip.enabled) {
+        ret = set_window(panel, x_start, y_start, x_end, y_end);
+        if (ret != ESP_OK) return ret;
+        ret = stream_pixels(panel, src, tile_w, tile_w, tile_h, true);
+    } else {
+        // Send only the visible part of each row, so invisible corner pixels
+        // never go over QSPI, narrowed to what changed since the shadow was
+        // last updated. Spans are grouped into bands (one window each).
+        size_t vis_px = clip_row_spans(panel, x_start, y_start, x_end, y_end);
+        bool diffed = false;
+        if (panel->shadow.fb) {
+            size_t changed_px = shadow_diff(panel, src, x_start, y_start, tile_w, tile_h);
+            if (changed_px * 100 <= vis_px * panel->shadow.full_pct) {
+                diffed = true;
+            } else {
+                // Mostly changed: one window beats many small ones
+                clip_row_spans(panel, x_start, y_start, x_end, y_end);
+                panel->stats.shadow_full_tiles++;
+            }
+        }
+        size_t num_bands = merge_bands(panel, panel->clip.row_span, y_start, tile_h);
+
+        size_t sent_px = 0;
+        ret = ESP_OK;
+        for (size_t i = 0; i < num_bands && ret == ESP_OK; i++) {
+            const band_t *b = &panel->clip.bands[i];
+            size_t bw = b->x1 - b->x0;
+            size_t bh = b->y1 - b->y0;
+            ret = set_window(panel, b->x0, b->y0, b->x1, b->y1);
+            if (ret == ESP_OK) {
+                const uint16_t *band_src = src + (b->y0 - y_start) * tile_w + (b->x0 - x_start);
+                ret = stream_pixels(panel, band_src, tile_w, bw, bh, i == num_bands - 1);
+            }
+            sent_px += bw * bh;
+        }
+        if (ret != ESP_OK) return ret;
+        if (diffed) {
+            panel->stats.clip_bytes_skipped += fmt_bytes(panel, tile_w * tile_h - vis_px);
+            if (sent_px < vis_px) {
+                panel->stats.shadow_bytes_avoided += fmt_bytes(panel, vis_px - sent_px);
+            }
+        } else {
+            panel->stats.clip_bytes_skipped += fmt_bytes(panel, tile_w * tile_h - sent_px);
+        }
+
+        if (num_bands == 0) {
+            // Nothing visible or nothing changed: nothing to wait for
+            tile_done_now(panel);
+            return ESP_OK;
+        }
+    }
+    if (ret != ESP_OK) return ret;
+
+    // Sync mode: block until the transfer has left the staging buffer
+    if (!panel->flush_done_cb) {
+        xSemaphoreTake(panel->done_sem, portMAX_DELAY);
+    }
+    return ESP_OK;
+}
+
+bool st77916_panel_visible_area(st77916_panel_handle_t panel, int *x_start, int *y_start, int *x_end, int *y_end)
+{
+    if (!panel->clip.round) {
+        return true;
+    }
+
+    // Vertical extent: rows whose visible span meets [x_start, x_end)
+    int y0 = *y_end;
+    int y1 = *y_start;
+    int x0 = *x_end;
+    int x1 = *x_start;
+    for (int y = *y_start; y < *y_end; y++) {
+        const span_t *vis = &panel->clip.row_vis[y];
+        int l = (vis->x0 > *x_start) ? vis->x0 : *x_start;
+        int r = (vis->x1 < *x_end) ? vis->x1 : *x_end;
+        if (l >= r) {
+            continue;
+        }
+        if (y < y0) y0 = y;
+        y1 = y + 1;
+        if (l < x0) x0 = l;
+        if (r > x1) x1 = r;
+    }
+    if (y0 >= y1) {
+        return false;
+    }
+
+    *x_start = x0;
+    *y_start = y0;
+    *x_end = x1;
+    *y_end = y1;
+    return true;
+}
+
+esp_err_t st77916_panel_set_pixel_format(st77916_panel_handle_t panel, st77916_pixel_format_t format)
+{
+    if (format >= sizeof(g_formats) / sizeof(g_formats[0])) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (format == panel->fmt) {
+        return ESP_OK;
+    }
+    esp_err_t ret = bringup_wait(panel);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // tx_param() drains queued color transfers, so pixels already in flight
+    // are sent in the old format before COLMOD changes
+    ret = send_cmd(panel, LCD_CMD_COLMOD, &g_formats[format].colmod, 1);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    panel->fmt = format;
+    update_chunk_pixels(panel);
+    // Unchanged pixels would keep the old format's color depth
+    shadow_invalidate(panel);
+    ESP_LOGI(TAG, "Pixel format: %d bpp, %d pixels per chunk",
+             g_formats[format].bits, panel->pool.chunk_pixels);
+    return ESP_OK;
+}
+
+esp_err_t st77916_panel_set_transport(st77916_panel_handle_t panel, esp_lcd_panel_io_handle_t io_handle,
+                                      st77916_transport_t transport)
+{
+    esp_err_t ret;
+
+    if (transport == ST77916_TRANSPORT_PANEL_IO && !io_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (panel->inflight.head != panel->inflight.tail || panel->direct.bus_acquired) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // Bring-up owns the bus until DISPON
+    if (panel->bringup.events && !panel->bringup.ready) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Detach the current transport
+    if (panel->direct.dev) {
+        ret = direct_drain(panel);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        spi_bus_remove_device(panel->direct.dev);
+        panel->direct.dev = NULL;
+    }
+    panel->io = NULL;
+    panel->transport = ST77916_TRANSPORT_NONE;
+
+    switch (transport) {
+    case ST77916_TRANSPORT_NONE:
+        return ESP_OK;
+
+    case ST77916_TRANSPORT_PANEL_IO: {
+        const esp_lcd_panel_io_callbacks_t cbs = {
+            .on_color_trans_done = color_trans_done,
+        };
+        ret = esp_lcd_panel_io_register_event_callbacks(io_handle, &cbs, panel);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to register color done callback: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        panel->io = io_handle;
+        break;
+    }
+
+    case ST77916_TRANSPORT_DIRECT_SPI: {
+        // Mode 3 like the panel IO; the post callback retires color transfers
+        spi_device_interface_config_t devcfg = {
+            .clock_speed_hz = panel->direct.pclk_hz,
+            .mode = 3,
+            .spics_io_num = panel->direct.cs_gpio,
+            .queue_size = DIRECT_QUEUE_SIZE,
+            .flags = SPI_DEVICE_HALFDUPLEX,
+            .post_cb = direct_trans_done,
+        };
+        ret = spi_bus_add_device(panel->direct.host, &devcfg, &panel->direct.dev);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to add SPI device: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        panel->direct.next = 0;
+        panel->direct.queued = 0;
+        break;
+    }
+
+    default:
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Window cache is per panel, but the new path has sent nothing yet
+    panel->win.caset_valid = panel->win.raset_valid = false;
+    panel->transport = transport;
+    return ESP_OK;
+}
+
+esp_err_t st77916_panel_frame_begin(st77916_panel_handle_t panel)
+{
+    // Frames drawn before DISPON only fill the shadow framebuffer. A shared
+    // bus is never held for a whole frame; the scheduler interleaves tiles.
+    if (!panel->bringup.ready || panel->sched || panel->transport != ST77916_TRANSPORT_DIRECT_SPI || panel->direct.bus_acquired) {
+        return ESP_OK;
+    }
+    esp_err_t ret = spi_device_acquire_bus(panel->direct.dev, portMAX_DELAY);
+    if (ret == ESP_OK) {
+        panel->direct.bus_acquired = true;
+    }
+    return ret;
+}
+
+esp_err_t st77916_panel_frame_end(st77916_panel_handle_t panel)
+{
+    if (!panel->direct.bus_acquired) {
+        return ESP_OK;
+    }
+    // The bus can only be released once the device has nothing queued
+    esp_err_t ret = direct_drain(panel);
+    spi_device_release_bus(panel->direct.dev);
+    panel->direct.bus_acquired = false;
+    return ret;
+}
+
+// Benchmark progress, shared with bench_tile_done()
+typedef struct {
+    st77916_panel_t *panel;
+    volatile uint32_t remaining;
+    volatile int64_t end_us;
+} bench_ctx_t;
+
+// Benchmark completion: counts down tiles, wakes the caller after the last
+static void IRAM_ATTR bench_tile_done(void *user_ctx)
+{
+    bench_ctx_t *ctx = user_ctx;
+    if (--ctx->remaining == 0) {
+        ctx->end_us = esp_timer_get_time();
+        xSemaphoreGiveFromISR(ctx->panel->done_sem, NULL);
+    }
+}
+
+esp_err_t st77916_panel_benchmark(st77916_panel_handle_t panel, const void *tile,
+                                  int tile_lines, uint32_t frames, st77916_bench_t *out)
+{
+    if (!tile || tile_lines <= 0 || frames == 0 || !out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = bringup_wait(panel);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (panel->transport == ST77916_TRANSPORT_NONE || panel->inflight.head != panel->inflight.tail) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Full-screen strips, no clipping or diffing: raw transport throughput
+    uint32_t strips = (panel->v_res + tile_lines - 1) / tile_lines;
+    bench_ctx_t ctx = { .panel = panel, .remaining = strips * frames };
+    st77916_flush_done_cb_t saved_cb = panel->flush_done_cb;
+    void *saved_ctx = panel->flush_done_ctx;
+    bool saved_clip = panel->clip.enabled;
+    panel->flush_done_cb = bench_tile_done;
+    panel->flush_done_ctx = &ctx;
+    panel->clip.enabled = false;
+
+    uint64_t bytes_base = panel->stats.bytes_sent;
+    int64_t start_us = esp_timer_get_time();
+    for (uint32_t f = 0; f < frames && ret == ESP_OK; f++) {
+        ret = st77916_panel_frame_begin(panel);
+        for (int y = 0; y < panel->v_res && ret == ESP_OK; y += tile_lines) {
+            int y_end = (y + tile_lines < panel->v_res) ? y + tile_lines : panel->v_res;
+            ret = st77916_panel_draw_bitmap(panel, 0, y, panel->h_res, y_end, tile);
+        }
+        esp_err_t end_ret = st77916_panel_frame_end(panel);
+        if (ret == ESP_OK) {
+            ret = end_ret;
+        }
+    }
+    if (ret == ESP_OK) {
+        xSemaphoreTake(panel->done_sem, portMAX_DELAY);
+    } else {
+        // Let whatever was queued finish before restoring the callback
+        while (panel->inflight.head != panel->inflight.tail) {
+            vTaskDelay(1);
+        }
+        xSemaphoreTake(panel->done_sem, 0);
+        ctx.end_us = esp_timer_get_time();
+    }
+    out->frames = frames;
+    out->bytes = panel->stats.bytes_sent - bytes_base;
+    out->elapsed_us = ctx.end_us - start_us;
+
+    panel->flush_done_cb = saved_cb;
+    panel->flush_done_ctx = saved_ctx;
+    panel->clip.enabled = saved_clip;
+    shadow_invalidate(panel);
+    return ret;
+}
+
+esp_err_t st77916_panel_draw_rle565(st77916_panel_handle_t panel, int x_start, int y_start,
+                                    const st77916_splash_t *image)
+{
+    if (!image || !image->rle || x_start < 0 || y_start < 0 ||
+        x_start + image->w > panel->h_res || y_start + image->h > panel->v_res) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = bringup_wait(panel);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // Completion is taken over for the duration of the image
+    if (panel->inflight.head != panel->inflight.tail) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return write_rle565(panel, x_start, y_start, image);
+}
+
+void st77916_panel_get_stats(st77916_panel_handle_t panel, st77916_panel_stats_t *out_stats)
+{
+    if (out_stats) {
+        *out_stats = panel->stats;
+    }
+}
+
+// NEW: Draw using manufacturer's command format (0x3C RAMWRC)
+// This matches how the STM32 manufacturer code sends pixel data
+esp_err_t st77916_panel_draw_bitmap_mfr(st77916_panel_handle_t panel,
+                                         int x_start, int y_start,
+                                         int x_end, int y_end,
+                                         const void *color_data)
+{
+    esp_err_t ret = bringup_wait(panel);
+    if (ret != ESP_OK) return ret;
+
+    // The caller's buffer goes out as-is: only valid while COLMOD is RGB565
+    if (panel->fmt != ST77916_PIXEL_RGB565) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Pixels bypass the shadow framebuffer
+    shadow_invalidate(panel);
+
+    // Set address window (CASET/RASET) - using standard 0x02 write opcode
+    ret = set_window(panel, x_start, y_start, x_end, y_end);
     if (ret != ESP_OK) return ret;
 
     // Send RAMWR (0x2C) to start memory write
-    ret = send_cmd(io_handle, LCD_CMD_RAMWR, NULL, 0);
+    ret = send_cmd(panel, LCD_CMD_RAMWR, NULL, 0);
     if (ret != ESP_OK) return ret;
 
     // Calculate pixel data size
@@ -534,8 +1695,11 @@ esp_err_t st77916_panel_draw_bitmap_mfr(esp_lcd_panel_io_handle_t io_handle,
     // Send pixel data using RAMWRC (0x3C) - manufacturer's approach
     // Format: [0x32 opcode] [0x3C cmd << 8] [pixel data]
     // This uses 0x3C (RAM Write Continue) instead of 0x2C
-    int lcd_cmd = (QSPI_CMD_WRITE_COLOR << 24) | (LCD_CMD_RAMWRC << 8);
-    ret = esp_lcd_panel_io_tx_color(io_handle, lcd_cmd, color_data, data_len);
+    inflight_push(panel, NULL, false);
+    ret = send_color(panel, LCD_CMD_RAMWRC, color_data, data_len);
+    if (ret != ESP_OK) {
+        inflight_unpush(panel);
+    }
 
     return ret;
 }
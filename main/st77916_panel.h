@@ -9,26 +9,191 @@
 #define ST77916_PANEL_H
 
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
 #include "esp_lcd_panel_io.h"
 #include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "st77916_bus_sched.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Maximum number of DMA staging buffers in the panel pool */
+#define ST77916_POOL_MAX_BUFS   4
+
+/**
+ * @brief Handle of one panel (one CS line)
+ */
+typedef struct st77916_panel_t st77916_panel_t;
+typedef st77916_panel_t *st77916_panel_handle_t;
+
+/**
+ * @brief Pixel format sent over QSPI
+ *
+ * Input is always LVGL's RGB565; it is converted while being copied into the
+ * DMA staging buffer.
+ */
+typedef enum {
+    ST77916_PIXEL_RGB565 = 0,   /*!< 16 bpp (COLMOD 0x05), 2 bytes per pixel */
+    ST77916_PIXEL_RGB444,       /*!< 12 bpp (COLMOD 0x03), 3 bytes per 2 pixels: 25% less bus traffic */
+    ST77916_PIXEL_RGB666,       /*!< 18 bpp (COLMOD 0x06), 3 bytes per pixel */
+} st77916_pixel_format_t;
+
+/**
+ * @brief Bus path used to reach the panel
+ */
+typedef enum {
+    ST77916_TRANSPORT_PANEL_IO = 0, /*!< esp_lcd panel IO created by the caller */
+    ST77916_TRANSPORT_DIRECT_SPI,   /*!< spi_master device owned by the driver: polled commands,
+                                         queued DMA pixel transactions, bus held per frame */
+    ST77916_TRANSPORT_NONE,         /*!< Detached, see st77916_panel_set_transport() */
+} st77916_transport_t;
+
+/**
+ * @brief Tile transfer complete callback (async flush mode)
+ *
+ * Called from the panel IO color-done ISR once the last byte of a
+ * st77916_panel_draw_bitmap() call has been sent. Must be ISR-safe.
+ *
+ * @param user_ctx User context from st77916_panel_config_t
+ */
+typedef void (*st77916_flush_done_cb_t)(void *user_ctx);
+
+/**
+ * @brief Panel bring-up phases, reported in order
+ */
+typedef enum {
+    ST77916_BRINGUP_RESET = 0,      /*!< Hardware reset pulse and its settle delay */
+    ST77916_BRINGUP_INIT_CMDS,      /*!< Manufacturer init sequence */
+    ST77916_BRINGUP_SLEEP_OUT,      /*!< SLPOUT sent, waiting out its delay */
+    ST77916_BRINGUP_SPLASH,         /*!< Splash image is in GRAM (display still off) */
+    ST77916_BRINGUP_FIRST_FRAME,    /*!< Frame drawn during bring-up is in GRAM (display still off) */
+    ST77916_BRINGUP_READY,          /*!< DISPON sent: draws go straight to the panel */
+    ST77916_BRINGUP_FAILED,         /*!< Bring-up stopped on a bus error */
+} st77916_bringup_phase_t;
+
+/**
+ * @brief Bring-up progress callback
+ *
+ * Called from the task running bring-up (the caller of st77916_panel_new(),
+ * or the driver's bring-up task with async_init).
+ *
+ * @param phase Phase just entered
+ * @param user_ctx User context from st77916_panel_config_t
+ */
+typedef void (*st77916_bringup_cb_t)(st77916_bringup_phase_t phase, void *user_ctx);
+
+/**
+ * @brief RLE565-compressed image in flash (see tools/splash_rle565.py)
+ */
+typedef struct {
+    uint16_t w;                 /*!< Width in pixels */
+    uint16_t h;                 /*!< Height in pixels */
+    const uint8_t *rle;         /*!< RLE565 stream, see st77916_rle565_t */
+    size_t rle_len;             /*!< Length of the stream in bytes */
+} st77916_splash_t;
+
+/**
+ * @brief Panel configuration
+ */
+typedef struct {
+    gpio_num_t rst_gpio;        /*!< Reset GPIO pin number, -1 if not used */
+    size_t max_tile_pixels;     /*!< Largest area (in pixels) passed to draw_bitmap, i.e. the LVGL draw buffer size */
+    uint8_t pool_bufs;          /*!< Number of DMA staging buffers to pre-allocate (1..ST77916_POOL_MAX_BUFS) */
+    size_t chunk_bytes;         /*!< Stream tiles in transfers of at most this many bytes (<= bus max_transfer_sz),
+                                     0 to send each tile in one transfer. Needs pool_bufs >= 2 to overlap.
+                                     Also the staging buffer size, so pixels per chunk follow the pixel format */
+    uint16_t h_res;             /*!< Horizontal resolution in pixels */
+    uint16_t v_res;             /*!< Vertical resolution in pixels */
+    bool round_clip;            /*!< Panel glass is the circle inscribed in h_res x v_res: skip pixels outside it */
+    st77916_pixel_format_t pixel_format;    /*!< Bus pixel format */
+    bool shadow_fb;             /*!< Keep a copy of GRAM in PSRAM (h_res * v_res * 2 bytes) and send only
+                                     the changed span of each row */
+    uint8_t shadow_full_pct;    /*!< Send the whole tile instead once more than this percentage of its
+                                     visible pixels changed, 0 for the default (50) */
+    st77916_flush_done_cb_t on_flush_done;  /*!< Async mode if set: draw_bitmap returns once queued, this fires on completion.
+                                                 If NULL, draw_bitmap blocks until the transfer is done.
+                                                 Called from task context for a tile with nothing visible to send */
+    void *user_ctx;             /*!< Passed to on_flush_done and on_bringup */
+    st77916_transport_t transport;  /*!< Bus path; io_handle may be NULL for DIRECT_SPI */
+    spi_host_device_t spi_host; /*!< DIRECT_SPI: host, already initialized with spi_bus_initialize() */
+    int cs_gpio;                /*!< DIRECT_SPI: chip select GPIO */
+    int pclk_hz;                /*!< DIRECT_SPI: SPI clock */
+    bool async_init;            /*!< Run reset and the init sequence on a driver task; st77916_panel_new()
+                                     returns once buffers are set up. Draws before the panel is ready are
+                                     collected in the shadow framebuffer and shown as the first frame
+                                     (without shadow_fb they block until ready) */
+    st77916_bringup_cb_t on_bringup;    /*!< Optional bring-up progress callback */
+    const st77916_splash_t *splash;     /*!< Image written to GRAM, centered, before DISPON when no frame
+                                             was drawn during bring-up yet. Should cover the screen:
+                                             the rest of GRAM is left as it is. NULL for none */
+    st77916_bus_sched_handle_t bus_sched;   /*!< Scheduler of the bus shared with other panels, NULL if
+                                                 this panel has the bus to itself */
+    uint8_t bus_weight;         /*!< Share of the bus under contention relative to the other panels
+                                     on bus_sched (0 counts as 1) */
+} st77916_panel_config_t;
+
+/**
+ * @brief Flush path statistics
+ */
+typedef struct {
+    uint32_t pool_hits;         /*!< Staging buffer was free when a flush needed it */
+    uint32_t pool_waits;        /*!< Flush had to wait for a staging buffer to be recycled */
+    uint32_t tiles;             /*!< draw_bitmap transfers completed */
+    uint32_t chunks;            /*!< Color transfers queued (tiles split into chunks) */
+    uint64_t bytes_sent;        /*!< Pixel bytes queued for transfer */
+    uint64_t clip_bytes_skipped;/*!< Pixel bytes not sent because they lie outside the round glass */
+    uint32_t transactions;      /*!< QSPI transactions issued (commands and color transfers) */
+    uint64_t cmd_bytes;         /*!< Non-pixel bytes sent: frame headers plus command parameters */
+    uint32_t window_cmds_skipped; /*!< CASET/RASET not sent because the window was unchanged */
+    uint64_t xfer_us;           /*!< Cumulative time the bus spent sending pixel data */
+    uint64_t shadow_bytes_avoided; /*!< Pixel bytes not sent because they match the shadow framebuffer */
+    uint32_t shadow_full_tiles; /*!< Tiles sent whole because too much of them changed */
+} st77916_panel_stats_t;
+
+/**
+ * @brief Transport benchmark result
+ */
+typedef struct {
+    uint32_t frames;            /*!< Full frames sent */
+    uint64_t bytes;             /*!< Pixel bytes sent */
+    int64_t elapsed_us;         /*!< From the first tile queued to the last one completed */
+} st77916_bench_t;
+
 /**
  * @brief Create and initialize ST77916 panel with manufacturer's settings
  *
- * @param io_handle LCD panel IO handle (QSPI)
- * @param rst_gpio Reset GPIO pin number
+ * Also allocates the DMA staging buffer pool, sized from config->max_tile_pixels.
+ * With config->async_init the panel itself is brought up in the background;
+ * see st77916_panel_wait_ready(). Panels live for the rest of the
+ * application; there is no delete.
+ *
+ * @param io_handle LCD panel IO handle (QSPI), NULL for DIRECT_SPI
+ * @param config Panel configuration
+ * @param ret_panel Returned panel handle, written only on success; on
+ *                  failure everything allocated so far is released
  * @return esp_err_t ESP_OK on success
  */
-esp_err_t st77916_panel_init(esp_lcd_panel_io_handle_t io_handle, gpio_num_t rst_gpio);
+esp_err_t st77916_panel_new(esp_lcd_panel_io_handle_t io_handle, const st77916_panel_config_t *config,
+                            st77916_panel_handle_t *ret_panel);
+
+/**
+ * @brief Wait for panel bring-up to finish
+ *
+ * @param timeout Ticks to wait, portMAX_DELAY for no limit
+ * @return esp_err_t ESP_OK once DISPON was sent, ESP_ERR_TIMEOUT, or the
+ *         bring-up error
+ */
+esp_err_t st77916_panel_wait_ready(st77916_panel_handle_t panel, TickType_t timeout);
 
 /**
  * @brief Draw bitmap to display
  *
- * @param io_handle LCD panel IO handle
+ * The pixels are byte-swapped into a staging buffer, so color_data is free for
+ * reuse once the transfer completes (see st77916_panel_config_t::on_flush_done).
+ *
+ * @param panel Panel handle
  * @param x_start Start X coordinate
  * @param y_start Start Y coordinate
  * @param x_end End X coordinate (exclusive)
@@ -36,7 +201,7 @@ esp_err_t st77916_panel_init(esp_lcd_panel_io_handle_t io_handle, gpio_num_t rst
  * @param color_data Pointer to RGB565 pixel data
  * @return esp_err_t ESP_OK on success
  */
-esp_err_t st77916_panel_draw_bitmap(esp_lcd_panel_io_handle_t io_handle,
+esp_err_t st77916_panel_draw_bitmap(st77916_panel_handle_t panel,
                                      int x_start, int y_start,
                                      int x_end, int y_end,
                                      const void *color_data);
@@ -49,19 +214,122 @@ esp_err_t st77916_panel_draw_bitmap(esp_lcd_panel_io_handle_t io_handle,
  * 2. Send RAMWR (0x2C)
  * 3. Send pixel data with RAMWRC (0x3C)
  *
- * @param io_handle LCD panel IO handle
+ * @param panel Panel handle
  * @param x_start Start X coordinate
  * @param y_start Start Y coordinate
  * @param x_end End X coordinate (exclusive)
  * @param y_end End Y coordinate (exclusive)
- * @param color_data Pointer to RGB565 pixel data
- * @return esp_err_t ESP_OK on success
+ * @param color_data Pointer to RGB565 pixel data, sent unconverted
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_STATE if the pixel
+ *         format is not ST77916_PIXEL_RGB565
  */
-esp_err_t st77916_panel_draw_bitmap_mfr(esp_lcd_panel_io_handle_t io_handle,
+esp_err_t st77916_panel_draw_bitmap_mfr(st77916_panel_handle_t panel,
                                          int x_start, int y_start,
                                          int x_end, int y_end,
                                          const void *color_data);
 
+/**
+ * @brief Decompress an RLE565 image straight into GRAM
+ *
+ * Decodes slice by slice into the DMA staging buffers, so no frame-sized
+ * RAM is used. Only while idle (no tiles in flight); returns once the
+ * image is in GRAM. Pixels bypass the shadow framebuffer, which is
+ * invalidated.
+ *
+ * @param x_start Left column of the image
+ * @param y_start Top row of the image
+ * @return esp_err_t ESP_ERR_INVALID_ARG if the image does not fit,
+ *         ESP_ERR_INVALID_STATE if transfers are in flight
+ */
+esp_err_t st77916_panel_draw_rle565(st77916_panel_handle_t panel, int x_start, int y_start,
+                                    const st77916_splash_t *image);
+
+/**
+ * @brief Change the bus pixel format at runtime (reprograms COLMOD)
+ *
+ * Must be called from the flushing task. Transfers already queued finish
+ * in the old format first. Without chunk_bytes, a format wider than the
+ * configured one is streamed in more than one transfer per tile.
+ *
+ * @param panel Panel handle
+ * @param format New pixel format
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t st77916_panel_set_pixel_format(st77916_panel_handle_t panel, st77916_pixel_format_t format);
+
+/**
+ * @brief Switch the bus path
+ *
+ * Only while idle: no tiles in flight and outside a frame. Because the
+ * panel IO and the direct SPI device share the CS pin, switch in two
+ * steps: detach with ST77916_TRANSPORT_NONE, delete or create the panel
+ * IO, then attach the new transport.
+ *
+ * @param panel Panel handle
+ * @param io_handle Panel IO for ST77916_TRANSPORT_PANEL_IO, otherwise ignored
+ * @param transport Transport to use from now on
+ * @return esp_err_t ESP_ERR_INVALID_STATE if transfers are still in flight
+ *         or bring-up has not finished
+ */
+esp_err_t st77916_panel_set_transport(st77916_panel_handle_t panel, esp_lcd_panel_io_handle_t io_handle,
+                                      st77916_transport_t transport);
+
+/**
+ * @brief Mark the start of a frame
+ *
+ * With the direct SPI transport, acquires the bus so the frame's commands
+ * and pixel transactions skip per-transaction bus arbitration. No-op for
+ * panel IO, and on a scheduled shared bus, where holding the bus for a
+ * whole frame would starve the other panels.
+ */
+esp_err_t st77916_panel_frame_begin(st77916_panel_handle_t panel);
+
+/**
+ * @brief Mark the end of a frame
+ *
+ * With the direct SPI transport, waits for the queued pixels and releases
+ * the bus. Call after the frame's last draw_bitmap.
+ */
+esp_err_t st77916_panel_frame_end(st77916_panel_handle_t panel);
+
+/**
+ * @brief Measure raw throughput of the active transport
+ *
+ * Sends the same full-width tile as strips over the whole screen, frames
+ * times, with clipping and the shadow diff bypassed. Must be called while
+ * idle, before anything else is flushing. GRAM contents afterwards are the
+ * test pattern.
+ *
+ * @param panel Panel handle
+ * @param tile h_res x tile_lines RGB565 pixels
+ * @param tile_lines Rows per strip
+ * @param frames Number of full frames to send
+ * @param out Result
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t st77916_panel_benchmark(st77916_panel_handle_t panel, const void *tile,
+                                  int tile_lines, uint32_t frames, st77916_bench_t *out);
+
+/**
+ * @brief Shrink an area to the bounding box of its visible pixels
+ *
+ * For use as an LVGL rounder so areas outside the round glass are not
+ * rendered. Does nothing unless round_clip is enabled. Coordinates are
+ * updated in place, end coordinates exclusive.
+ *
+ * @return true if any part of the area is visible
+ */
+bool st77916_panel_visible_area(st77916_panel_handle_t panel, int *x_start, int *y_start,
+                                int *x_end, int *y_end);
+
+/**
+ * @brief Read flush path statistics
+ *
+ * @param panel Panel handle
+ * @param out_stats Destination for a copy of the counters
+ */
+void st77916_panel_get_stats(st77916_panel_handle_t panel, st77916_panel_stats_t *out_stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,257 @@
+/**
+ * ST77916 Pixel Conversion Kernels
+ *
+ * The swap runs over every pixel sent to the panel (129,600 per full
+ * 360x360 frame), so the word kernel is the one used on the flush path.
+ */
+
+#include "st77916_pixel.h"
+
+// Word view of pixel buffers that are declared as uint16_t / lv_color_t
+typedef uint32_t __attribute__((may_alias)) word_t;
+
+// Swap the bytes of both RGB565 pixels packed in a 32-bit word
+#define SWAP565_X2(w)   ((((w) & 0x00FF00FFu) << 8) | (((w) >> 8) & 0x00FF00FFu))
+
+static inline uint16_t swap565(uint16_t color)
+{
+    return (uint16_t)((color >> 8) | (color << 8));
+}
+
+void st77916_swap565_generic(uint16_t *dst, const uint16_t *src, size_t num_pixels)
+{
+    for (size_t i = 0; i < num_pixels; i++) {
+        dst[i] = swap565(src[i]);
+    }
+}
+
+// dst word aligned, src one half-word off: each output word is the high
+// half of one aligned source word and the low half of the next (a funnel
+// shift by 16, little-endian), the high half carried between iterations
+static void swap565_shifted(uint16_t *dst, const uint16_t *src, size_t num_pixels)
+{
+    if (num_pixels == 0) {
+        return;
+    }
+    word_t *d = (word_t *)dst;
+    const word_t *s = (const word_t *)(src + 1);
+    // Every word but the one holding the last pixel, so loads stay inside src
+    size_t words = (num_pixels - 1) / 2;
+    uint32_t carry = src[0];
+
+    while (words >= 4) {
+        uint32_t w0 = s[0];
+        uint32_t w1 = s[1];
+        uint32_t w2 = s[2];
+        uint32_t w3 = s[3];
+        d[0] = SWAP565_X2(carry | (w0 << 16));
+        d[1] = SWAP565_X2((w0 >> 16) | (w1 << 16));
+        d[2] = SWAP565_X2((w1 >> 16) | (w2 << 16));
+        d[3] = SWAP565_X2((w2 >> 16) | (w3 << 16));
+        carry = w3 >> 16;
+        s += 4;
+        d += 4;
+        words -= 4;
+    }
+    while (words > 0) {
+        uint32_t w = *s++;
+        *d++ = SWAP565_X2(carry | (w << 16));
+        carry = w >> 16;
+        words--;
+    }
+
+    // Tail: the carried pixel, and one more for an even count
+    uint16_t *t = (uint16_t *)d;
+    t[0] = swap565((uint16_t)carry);
+    if ((num_pixels & 1) == 0) {
+        t[1] = swap565(*(const uint16_t *)s);
+    }
+}
+
+void st77916_swap565_word(uint16_t *dst, const uint16_t *src, size_t num_pixels)
+{
+    // Head: one pixel brings a half-word aligned dst onto a word boundary
+    if (((uintptr_t)dst & 3) != 0 && num_pixels > 0) {
+        *dst++ = swap565(*src++);
+        num_pixels--;
+    }
+    // Clipped rows and band offsets start src at either parity
+    if (((uintptr_t)src & 3) != 0) {
+        swap565_shifted(dst, src, num_pixels);
+        return;
+    }
+
+    word_t *d = (word_t *)dst;
+    const word_t *s = (const word_t *)src;
+    size_t words = num_pixels / 2;
+
+    // Body: 4 words (8 pixels) per iteration
+    while (words >= 4) {
+        uint32_t w0 = s[0];
+        uint32_t w1 = s[1];
+        uint32_t w2 = s[2];
+        uint32_t w3 = s[3];
+        d[0] = SWAP565_X2(w0);
+        d[1] = SWAP565_X2(w1);
+        d[2] = SWAP565_X2(w2);
+        d[3] = SWAP565_X2(w3);
+        s += 4;
+        d += 4;
+        words -= 4;
+    }
+    while (words > 0) {
+        uint32_t w = *s++;
+        *d++ = SWAP565_X2(w);
+        words--;
+    }
+
+    // Tail: odd pixel left over
+    if (num_pixels & 1) {
+        *(uint16_t *)d = swap565(*(const uint16_t *)s);
+    }
+}
+
+size_t st77916_pack444(uint8_t *dst, const uint16_t *src, size_t num_pixels)
+{
+    uint8_t *d = dst;
+    size_t pairs = num_pixels / 2;
+
+    for (size_t i = 0; i < pairs; i++) {
+        uint16_t a = src[0];
+        uint16_t b = src[1];
+        src += 2;
+        d[0] = ((a >> 8) & 0xF0) | ((a >> 7) & 0x0F);   // R1 G1
+        d[1] = ((a << 3) & 0xF0) | ((b >> 12) & 0x0F);  // B1 R2
+        d[2] = ((b >> 3) & 0xF0) | ((b >> 1) & 0x0F);   // G2 B2
+        d += 3;
+    }
+
+    if (num_pixels & 1) {
+        uint16_t a = src[0];
+        d[0] = ((a >> 8) & 0xF0) | ((a >> 7) & 0x0F);
+        d[1] = (a << 3) & 0xF0;
+        d += 2;
+    }
+
+    return d - dst;
+}
+
+size_t st77916_pack666(uint8_t *dst, const uint16_t *src, size_t num_pixels)
+{
+    uint8_t *d = dst;
+
+    for (size_t i = 0; i < num_pixels; i++) {
+        uint16_t c = src[i];
+        d[0] = ((c >> 8) & 0xF8) | ((c >> 13) & 0x07);  // R5 -> R8
+        d[1] = ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);   // G6 -> G8
+        d[2] = ((c << 3) & 0xF8) | ((c >> 2) & 0x07);   // B5 -> B8
+        d += 3;
+    }
+
+    return d - dst;
+}
+
+size_t st77916_diff565_first(const uint16_t *a, const uint16_t *b, size_t num_pixels)
+{
+    size_t i = 0;
+
+    if ((((uintptr_t)a ^ (uintptr_t)b) & 3) == 0) {
+        if (((uintptr_t)a & 3) != 0 && num_pixels > 0) {
+            if (a[0] != b[0]) {
+                return 0;
+            }
+            i = 1;
+        }
+        while (i + 2 <= num_pixels && *(const word_t *)(a + i) == *(const word_t *)(b + i)) {
+            i += 2;
+        }
+    }
+    // Tail, the differing pixel within a word, or misaligned runs
+    while (i < num_pixels && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+size_t st77916_diff565_last(const uint16_t *a, const uint16_t *b, size_t num_pixels)
+{
+    size_t i = num_pixels;
+
+    if ((((uintptr_t)a ^ (uintptr_t)b) & 3) == 0) {
+        if (((uintptr_t)(a + i) & 3) != 0 && i > 0) {
+            if (a[i - 1] != b[i - 1]) {
+                return i;
+            }
+            i--;
+        }
+        while (i >= 2 && *(const word_t *)(a + i - 2) == *(const word_t *)(b + i - 2)) {
+            i -= 2;
+        }
+    }
+    while (i > 0 && a[i - 1] == b[i - 1]) {
+        i--;
+    }
+    return i;
+}
+
+void st77916_rle565_init(st77916_rle565_t *dec, const uint8_t *data, size_t len)
+{
+    dec->pos = data;
+    dec->end = data + len;
+    dec->left = 0;
+    dec->literal = false;
+    dec->color = 0;
+}
+
+size_t st77916_rle565_decode(st77916_rle565_t *dec, uint16_t *dst, size_t num_pixels)
+{
+    size_t out = 0;
+    while (out < num_pixels) {
+        if (dec->left == 0) {
+            // Next packet header, plus the color for a run
+            if (dec->pos >= dec->end) {
+                break;
+            }
+            uint8_t h = *dec->pos++;
+            dec->literal = !(h & 0x80);
+            dec->left = (h & 0x7F) + 1;
+            if (!dec->literal) {
+                if (dec->end - dec->pos < 2) {
+                    dec->left = 0;
+                    break;
+                }
+                dec->color = dec->pos[0] | (dec->pos[1] << 8);
+                dec->pos += 2;
+            }
+        }
+
+        size_t n = num_pixels - out;
+        if (n > dec->left) {
+            n = dec->left;
+        }
+        if (dec->literal) {
+            // Literal pixels are byte-aligned in flash
+            size_t avail = (size_t)(dec->end - dec->pos) / 2;
+            if (n > avail) {
+                // Truncated: end the stream after what is there
+                n = avail;
+                dec->left = (uint8_t)n;
+                dec->end = dec->pos + n * 2;
+                if (n == 0) {
+                    break;
+                }
+            }
+            for (size_t i = 0; i < n; i++) {
+                dst[out + i] = dec->pos[0] | (dec->pos[1] << 8);
+                dec->pos += 2;
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                dst[out + i] = dec->color;
+            }
+        }
+        dec->left -= n;
+        out += n;
+    }
+    return out;
+}
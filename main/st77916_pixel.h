@@ -0,0 +1,135 @@
+/**
+ * ST77916 Pixel Conversion Kernels
+ *
+ * Converts LVGL's native (little-endian) RGB565 pixels into the byte stream
+ * the ST77916 expects on the QSPI bus for each COLMOD setting, compares
+ * pixel runs for the shadow framebuffer, and decodes RLE565 image assets.
+ * Pure C, no ESP-IDF dependencies, so
+ * the kernels can be built and compared on a host.
+ */
+
+#ifndef ST77916_PIXEL_H
+#define ST77916_PIXEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Byte-swap RGB565 pixels, one pixel at a time
+ *
+ * Reference kernel: every other kernel must produce byte-identical output.
+ *
+ * @param dst Destination buffer (may be the same as src for in-place)
+ * @param src Source buffer
+ * @param num_pixels Number of RGB565 pixels
+ */
+void st77916_swap565_generic(uint16_t *dst, const uint16_t *src, size_t num_pixels);
+
+/**
+ * @brief Byte-swap RGB565 pixels two at a time through 32-bit words
+ *
+ * Aligns dst to a word boundary with a single-pixel head, swaps 8 pixels
+ * per unrolled iteration, then finishes the tail per pixel. When src is
+ * then a half-word off, each output word is funnel-shifted from two
+ * aligned source words, so every alignment stays on the word path.
+ *
+ * @param dst Destination buffer (may be the same as src for in-place)
+ * @param src Source buffer
+ * @param num_pixels Number of RGB565 pixels
+ */
+void st77916_swap565_word(uint16_t *dst, const uint16_t *src, size_t num_pixels);
+
+/**
+ * @brief Byte-swap RGB565 pixels with the fastest available kernel
+ */
+static inline void st77916_swap565(uint16_t *dst, const uint16_t *src, size_t num_pixels)
+{
+    st77916_swap565_word(dst, src, num_pixels);
+}
+
+/**
+ * @brief Pack RGB565 pixels into 12-bit RGB444 (COLMOD 0x03)
+ *
+ * Two pixels become three bytes: R1G1 B1R2 G2B2, each channel truncated to
+ * its top 4 bits. An odd final pixel is emitted as R G B 0 (two bytes); the
+ * trailing nibble is dropped by the panel when CS rises.
+ *
+ * dst may alias src: output never overtakes input.
+ *
+ * @return Number of bytes written
+ */
+size_t st77916_pack444(uint8_t *dst, const uint16_t *src, size_t num_pixels);
+
+/**
+ * @brief Expand RGB565 pixels into 18-bit RGB666 (COLMOD 0x06)
+ *
+ * One pixel becomes three bytes R G B, each channel MSB-aligned with its
+ * top bits replicated into the low bits. dst must not overlap src.
+ *
+ * @return Number of bytes written
+ */
+size_t st77916_pack666(uint8_t *dst, const uint16_t *src, size_t num_pixels);
+
+/**
+ * @brief Find the first pixel that differs between two runs
+ *
+ * Compares two pixels per 32-bit load when a and b share word alignment.
+ *
+ * @return Index of the first differing pixel, num_pixels if the runs match
+ */
+size_t st77916_diff565_first(const uint16_t *a, const uint16_t *b, size_t num_pixels);
+
+/**
+ * @brief Find the end of the last differing pixel between two runs
+ *
+ * Scans backwards, two pixels per 32-bit load when a and b share word
+ * alignment.
+ *
+ * @return Index one past the last differing pixel, 0 if the runs match
+ */
+size_t st77916_diff565_last(const uint16_t *a, const uint16_t *b, size_t num_pixels);
+
+/**
+ * @brief RLE565 decoder state
+ *
+ * RLE565 is a byte stream of packets, each starting with a header byte h:
+ * - h & 0x80: run, one pixel repeated (h & 0x7F) + 1 times
+ * - otherwise: literal, (h + 1) distinct pixels follow
+ *
+ * Pixels are little-endian RGB565, like LVGL's. Packets may span image
+ * rows. tools/splash_rle565.py produces this format.
+ */
+typedef struct {
+    const uint8_t *pos;         /*!< Next unread byte */
+    const uint8_t *end;         /*!< End of the encoded data */
+    uint8_t left;               /*!< Pixels left in the current packet */
+    bool literal;               /*!< Current packet is a literal */
+    uint16_t color;             /*!< Run color */
+} st77916_rle565_t;
+
+/**
+ * @brief Start decoding an RLE565 stream
+ */
+void st77916_rle565_init(st77916_rle565_t *dec, const uint8_t *data, size_t len);
+
+/**
+ * @brief Decode the next pixels of an RLE565 stream
+ *
+ * Resumes where the previous call stopped, so an image can be decoded in
+ * slices of any size.
+ *
+ * @return Number of pixels written, less than num_pixels only at the end of
+ *         the stream (or on truncated data)
+ */
+size_t st77916_rle565_decode(st77916_rle565_t *dec, uint16_t *dst, size_t num_pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ST77916_PIXEL_H */
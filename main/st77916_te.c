@@ -0,0 +1,153 @@
+/**
+ * ST77916 Tearing-Effect (TE) Frame Scheduling
+ *
+ * A frame starts right behind a TE edge and "misses" when its transfer has
+ * not finished by the next one: it then spans two scans and part of the
+ * old frame is shown together with part of the new one.
+ */
+
+#include "st77916_te.h"
+#include <stddef.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#else
+#define IRAM_ATTR
+#endif
+
+// Moving average weight for the scan period: 1/8 per edge
+#define TE_PERIOD_AVG_SHIFT     3
+
+static struct {
+    st77916_te_notify_t notify;
+    void *user_ctx;
+    int64_t last_edge_us;
+    int64_t frame_start_us;     // 0 when no frame transfer is running
+    uint32_t edges_in_frame;    // TE edges since the frame transfer began
+    st77916_te_stats_t stats;
+} s_te;
+
+void st77916_te_reset(st77916_te_notify_t notify, void *user_ctx)
+{
+    s_te.notify = notify;
+    s_te.user_ctx = user_ctx;
+    s_te.last_edge_us = 0;
+    s_te.frame_start_us = 0;
+    s_te.edges_in_frame = 0;
+    s_te.stats = (st77916_te_stats_t){0};
+}
+
+void IRAM_ATTR st77916_te_edge(int64_t now_us)
+{
+    st77916_te_stats_t *st = &s_te.stats;
+
+    if (s_te.last_edge_us != 0) {
+        uint32_t interval = (uint32_t)(now_us - s_te.last_edge_us);
+        if (st->period_us == 0) {
+            st->period_us = interval;
+            st->period_min_us = interval;
+            st->period_max_us = interval;
+        } else {
+            st->period_us += ((int32_t)interval - (int32_t)st->period_us) >> TE_PERIOD_AVG_SHIFT;
+            if (interval < st->period_min_us) st->period_min_us = interval;
+            if (interval > st->period_max_us) st->period_max_us = interval;
+        }
+    }
+    s_te.last_edge_us = now_us;
+    st->edges++;
+
+    if (s_te.frame_start_us != 0) {
+        s_te.edges_in_frame++;
+    }
+
+    if (s_te.notify) {
+        s_te.notify(s_te.user_ctx);
+    }
+}
+
+void st77916_te_frame_begin(int64_t now_us)
+{
+    s_te.frame_start_us = now_us;
+    s_te.edges_in_frame = 0;
+}
+
+void IRAM_ATTR st77916_te_frame_end(int64_t now_us)
+{
+    (void)now_us;
+    if (s_te.frame_start_us == 0) {
+        return;
+    }
+    s_te.stats.frames++;
+    if (s_te.edges_in_frame > 0) {
+        s_te.stats.missed++;
+    }
+    s_te.frame_start_us = 0;
+}
+
+void st77916_te_get_stats(st77916_te_stats_t *out_stats)
+{
+    if (out_stats) {
+        *out_stats = s_te.stats;
+    }
+}
+
+#ifdef ESP_PLATFORM
+
+static const char *TAG = "ST77916_TE";
+
+static void IRAM_ATTR te_gpio_isr(void *arg)
+{
+    st77916_te_edge(esp_timer_get_time());
+}
+
+static void te_sim_cb(void *arg)
+{
+    st77916_te_edge(esp_timer_get_time());
+}
+
+esp_err_t st77916_te_start_gpio(gpio_num_t te_gpio, st77916_te_notify_t notify, void *user_ctx)
+{
+    esp_err_t ret;
+
+    st77916_te_reset(notify, user_ctx);
+
+    gpio_config_t io_conf = {
+        .mode         = GPIO_MODE_INPUT,
+        .pin_bit_mask = 1ULL << te_gpio,
+        .intr_type    = GPIO_INTR_POSEDGE,
+    };
+    ret = gpio_config(&io_conf);
+    if (ret != ESP_OK) return ret;
+
+    // The service may already be installed by another driver
+    ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) return ret;
+
+    ret = gpio_isr_handler_add(te_gpio, te_gpio_isr, NULL);
+    if (ret != ESP_OK) return ret;
+
+    ESP_LOGI(TAG, "TE sync on GPIO%d", te_gpio);
+    return ESP_OK;
+}
+
+esp_err_t st77916_te_start_sim(uint32_t period_us, st77916_te_notify_t notify, void *user_ctx)
+{
+    esp_err_t ret;
+
+    st77916_te_reset(notify, user_ctx);
+
+    const esp_timer_create_args_t args = {
+        .callback = te_sim_cb,
+        .name     = "te_sim",
+    };
+    esp_timer_handle_t timer;
+    ret = esp_timer_create(&args, &timer);
+    if (ret != ESP_OK) return ret;
+
+    ESP_LOGI(TAG, "TE sync simulated at %lu us", (unsigned long)period_us);
+    return esp_timer_start_periodic(timer, period_us);
+}
+
+#endif /* ESP_PLATFORM */
@@ -0,0 +1,100 @@
+/**
+ * ST77916 Tearing-Effect (TE) Frame Scheduling
+ *
+ * The panel pulses its TE line at the start of every scan (TEON, mode 0).
+ * A TE source reports each edge; the core measures the real scan period,
+ * wakes the renderer so the next frame's transfer starts right behind the
+ * scan, and counts frames whose transfer was still running when the
+ * following edge arrived (the scan overtook the write: a visible tear).
+ *
+ * The core is plain C so a simulated source can drive it off-target; the
+ * GPIO and esp_timer sources are only built for ESP-IDF.
+ */
+
+#ifndef ST77916_TE_H
+#define ST77916_TE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#include "driver/gpio.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Called on every TE edge, from the context of the TE source
+ *
+ * ISR context for the GPIO source. Must be short and ISR-safe.
+ */
+typedef void (*st77916_te_notify_t)(void *user_ctx);
+
+/**
+ * @brief TE timing statistics
+ */
+typedef struct {
+    uint32_t edges;             /*!< TE edges seen */
+    uint32_t period_us;         /*!< Measured scan period (moving average) */
+    uint32_t period_min_us;     /*!< Shortest edge interval seen */
+    uint32_t period_max_us;     /*!< Longest edge interval seen */
+    uint32_t frames;            /*!< Frame transfers completed */
+    uint32_t missed;            /*!< Frame transfers that overran the scan window */
+} st77916_te_stats_t;
+
+/**
+ * @brief Reset statistics and set the edge notification
+ */
+void st77916_te_reset(st77916_te_notify_t notify, void *user_ctx);
+
+/**
+ * @brief Report a TE edge (called by the TE source)
+ *
+ * @param now_us Timestamp of the edge in microseconds
+ */
+void st77916_te_edge(int64_t now_us);
+
+/**
+ * @brief Mark the start of a frame transfer (first tile handed to the panel)
+ */
+void st77916_te_frame_begin(int64_t now_us);
+
+/**
+ * @brief Mark the end of a frame transfer (last tile sent); ISR-safe
+ */
+void st77916_te_frame_end(int64_t now_us);
+
+/**
+ * @brief Read TE statistics
+ */
+void st77916_te_get_stats(st77916_te_stats_t *out_stats);
+
+#ifdef ESP_PLATFORM
+/**
+ * @brief Drive the core from the panel's TE pin (rising edge ISR)
+ *
+ * @param te_gpio GPIO connected to the panel TE output
+ * @param notify Edge notification, called from ISR context
+ * @param user_ctx Passed to notify
+ */
+esp_err_t st77916_te_start_gpio(gpio_num_t te_gpio, st77916_te_notify_t notify, void *user_ctx);
+
+/**
+ * @brief Drive the core from a periodic esp_timer instead of the TE pin
+ *
+ * For boards without TE wired, and for exercising the scheduler without a
+ * panel. notify is called from the esp_timer task.
+ *
+ * @param period_us Simulated scan period
+ */
+esp_err_t st77916_te_start_sim(uint32_t period_us, st77916_te_notify_t notify, void *user_ctx);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ST77916_TE_H */
@@ -0,0 +1,267 @@
+/**
+ * Vehicle Speed Sensor
+ *
+ * The capture interrupt and vss_read() share the last period under a
+ * spinlock; they run on the same core, so it only masks the interrupt for
+ * a few loads and stores.
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/pulse_cnt.h"
+#include "driver/mcpwm_cap.h"
+#include "vss.h"
+
+static const char *TAG = "vss";
+
+// Counter limits: the driver accumulates at each wrap (watch point interrupt)
+#define PCNT_HIGH_LIMIT         32767
+#define PCNT_LOW_LIMIT          (-32768)
+// Hall edges are clean; this rejects ignition spikes on the harness
+#define PCNT_GLITCH_NS          1000
+
+// Counter window: a sample every 100 ms, speed over the last 500-600 ms
+#define COUNT_SAMPLE_US         100000
+#define COUNT_SAMPLES           6
+
+static struct {
+    vss_config_t cfg;
+    pcnt_unit_handle_t pcnt;
+    mcpwm_cap_timer_handle_t cap_timer;
+    mcpwm_cap_channel_handle_t cap_chan;
+    uint32_t cap_hz;            // Capture timer resolution
+    bool capture_on;
+
+    // Written by the capture interrupt, under lock
+    portMUX_TYPE lock;
+    bool have_edge;             // An edge since capture was enabled
+    uint32_t last_cap;
+    uint32_t period_ticks;      // 0 until two edges since capture was enabled
+    int64_t edge_us;
+    uint32_t captures;
+
+    // Counter window, vss_read() only
+    struct {
+        int32_t count;
+        int64_t us;
+    } samples[COUNT_SAMPLES];
+    uint8_t sample_next;
+    uint8_t sample_len;
+    int32_t last_count;
+    int64_t last_move_us;       // When the count last changed
+} s_vss = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static bool IRAM_ATTR vss_capture_isr(mcpwm_cap_channel_handle_t chan,
+                                      const mcpwm_capture_event_data_t *edata, void *arg)
+{
+    int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&s_vss.lock);
+    if (s_vss.have_edge) {
+        s_vss.period_ticks = edata->cap_value - s_vss.last_cap;
+    }
+    s_vss.last_cap = edata->cap_value;
+    s_vss.have_edge = true;
+    s_vss.edge_us = now_us;
+    s_vss.captures++;
+    portEXIT_CRITICAL_ISR(&s_vss.lock);
+    return false;
+}
+
+static esp_err_t capture_enable(bool on)
+{
+    if (on == s_vss.capture_on) {
+        return ESP_OK;
+    }
+    if (on) {
+        // The edge before the gap would give a bogus period
+        portENTER_CRITICAL(&s_vss.lock);
+        s_vss.have_edge = false;
+        s_vss.period_ticks = 0;
+        portEXIT_CRITICAL(&s_vss.lock);
+    }
+    esp_err_t ret = on ? mcpwm_capture_channel_enable(s_vss.cap_chan)
+                       : mcpwm_capture_channel_disable(s_vss.cap_chan);
+    if (ret == ESP_OK) {
+        s_vss.capture_on = on;
+        ESP_LOGD(TAG, "Capture %s", on ? "on" : "off");
+    }
+    return ret;
+}
+
+static esp_err_t counter_setup(void)
+{
+    const pcnt_unit_config_t unit_config = {
+        .low_limit  = PCNT_LOW_LIMIT,
+        .high_limit = PCNT_HIGH_LIMIT,
+        .flags.accum_count = true,
+    };
+    esp_err_t ret = pcnt_new_unit(&unit_config, &s_vss.pcnt);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    const pcnt_glitch_filter_config_t filter_config = {
+        .max_glitch_ns = PCNT_GLITCH_NS,
+    };
+    const pcnt_chan_config_t chan_config = {
+        .edge_gpio_num  = s_vss.cfg.gpio,
+        .level_gpio_num = -1,
+    };
+    pcnt_channel_handle_t chan;
+    if ((ret = pcnt_unit_set_glitch_filter(s_vss.pcnt, &filter_config)) != ESP_OK ||
+        (ret = pcnt_new_channel(s_vss.pcnt, &chan_config, &chan)) != ESP_OK ||
+        (ret = pcnt_channel_set_edge_action(chan, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                                            PCNT_CHANNEL_EDGE_ACTION_HOLD)) != ESP_OK ||
+        (ret = pcnt_unit_add_watch_point(s_vss.pcnt, PCNT_HIGH_LIMIT)) != ESP_OK ||
+        (ret = pcnt_unit_enable(s_vss.pcnt)) != ESP_OK ||
+        (ret = pcnt_unit_clear_count(s_vss.pcnt)) != ESP_OK) {
+        return ret;
+    }
+    return pcnt_unit_start(s_vss.pcnt);
+}
+
+static esp_err_t capture_setup(void)
+{
+    const mcpwm_capture_timer_config_t timer_config = {
+        .group_id = 0,
+        .clk_src  = MCPWM_CAPTURE_CLK_SRC_DEFAULT,
+    };
+    esp_err_t ret = mcpwm_new_capture_timer(&timer_config, &s_vss.cap_timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    const mcpwm_capture_channel_config_t chan_config = {
+        .gpio_num       = s_vss.cfg.gpio,
+        .prescale       = 1,
+        .flags.pos_edge = true,
+        .flags.pull_up  = true,
+    };
+    const mcpwm_capture_event_callbacks_t cbs = {
+        .on_cap = vss_capture_isr,
+    };
+    if ((ret = mcpwm_new_capture_channel(s_vss.cap_timer, &chan_config, &s_vss.cap_chan)) != ESP_OK ||
+        (ret = mcpwm_capture_channel_register_event_callbacks(s_vss.cap_chan, &cbs, NULL)) != ESP_OK ||
+        (ret = mcpwm_capture_timer_get_resolution(s_vss.cap_timer, &s_vss.cap_hz)) != ESP_OK ||
+        (ret = mcpwm_capture_timer_enable(s_vss.cap_timer)) != ESP_OK ||
+        (ret = mcpwm_capture_timer_start(s_vss.cap_timer)) != ESP_OK) {
+        return ret;
+    }
+    // Standing still at boot: period timing first
+    return capture_enable(true);
+}
+
+esp_err_t vss_start(const vss_config_t *config)
+{
+    if (!config || config->gpio < 0 || config->pulses_per_mile <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_vss.cfg = *config;
+    esp_err_t ret = counter_setup();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Pulse counter setup failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ret = capture_setup();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Capture setup failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    // Both drivers route the pin; make sure the pull-up holds an open-collector sensor high
+    gpio_set_pull_mode(config->gpio, GPIO_PULLUP_ONLY);
+    s_vss.last_move_us = esp_timer_get_time() - VSS_STOP_MS * 1000LL;
+    ESP_LOGI(TAG, "GPIO %d, %.0f pulses/mile, capture timer %" PRIu32 " Hz", config->gpio,
+             config->pulses_per_mile, s_vss.cap_hz);
+    return ESP_OK;
+}
+
+// Pulse rate over the counter window, which this call advances
+static float count_rate(int32_t count, int64_t now_us)
+{
+    uint8_t newest = (s_vss.sample_next + COUNT_SAMPLES - 1) % COUNT_SAMPLES;
+    if (s_vss.sample_len == 0 || now_us - s_vss.samples[newest].us >= COUNT_SAMPLE_US) {
+        s_vss.samples[s_vss.sample_next].count = count;
+        s_vss.samples[s_vss.sample_next].us = now_us;
+        s_vss.sample_next = (s_vss.sample_next + 1) % COUNT_SAMPLES;
+        if (s_vss.sample_len < COUNT_SAMPLES) {
+            s_vss.sample_len++;
+        }
+    }
+    uint8_t oldest = (s_vss.sample_next + COUNT_SAMPLES - s_vss.sample_len) % COUNT_SAMPLES;
+    int64_t dt_us = now_us - s_vss.samples[oldest].us;
+    return dt_us > 0 ? (count - s_vss.samples[oldest].count) * 1e6f / dt_us : 0;
+}
+
+// Pulse rate from the last period, falling as 1/age once the next edge is overdue
+static float period_rate(int64_t now_us, uint32_t *captures)
+{
+    portENTER_CRITICAL(&s_vss.lock);
+    uint32_t period_ticks = s_vss.period_ticks;
+    int64_t edge_us = s_vss.edge_us;
+    *captures = s_vss.captures;
+    portEXIT_CRITICAL(&s_vss.lock);
+
+    if (!s_vss.capture_on || period_ticks == 0) {
+        return 0;
+    }
+    int64_t age_us = now_us - edge_us;
+    if (age_us >= VSS_STOP_MS * 1000LL) {
+        return 0;
+    }
+    float hz = (float)s_vss.cap_hz / period_ticks;
+    if (age_us * hz > 1e6f) {
+        hz = 1e6f / age_us;
+    }
+    return hz;
+}
+
+esp_err_t vss_read(vss_reading_t *out)
+{
+    if (!s_vss.pcnt) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    int count;
+    esp_err_t ret = pcnt_unit_get_count(s_vss.pcnt, &count);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    int64_t now_us = esp_timer_get_time();
+    if (count != s_vss.last_count) {
+        s_vss.last_count = count;
+        s_vss.last_move_us = now_us;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->pulses = count;
+    out->moving = now_us - s_vss.last_move_us < VSS_STOP_MS * 1000LL;
+    out->count_hz = count_rate(count, now_us);
+    out->period_hz = period_rate(now_us, &out->captures);
+
+    // Weight of the count: by the period's rate when there is one, which
+    // is the better figure down where the blend starts
+    float ref_hz = out->period_hz > 0 ? out->period_hz : out->count_hz;
+    if (out->period_hz == 0 && out->moving) {
+        out->blend = 1;             // No period yet (capture just resumed)
+    } else if (ref_hz <= VSS_BLEND_LOW_HZ) {
+        out->blend = 0;
+    } else if (ref_hz >= VSS_BLEND_HIGH_HZ) {
+        out->blend = 1;
+    } else {
+        out->blend = (ref_hz - VSS_BLEND_LOW_HZ) / (VSS_BLEND_HIGH_HZ - VSS_BLEND_LOW_HZ);
+    }
+    float hz = out->moving ? out->period_hz * (1 - out->blend) + out->count_hz * out->blend : 0;
+    out->mph = hz * 3600.0f / s_vss.cfg.pulses_per_mile;
+
+    // Capture interrupts only where the period is worth having
+    if (s_vss.capture_on && out->count_hz > VSS_CAPTURE_OFF_HZ) {
+        capture_enable(false);
+    } else if (!s_vss.capture_on && out->count_hz < VSS_CAPTURE_ON_HZ) {
+        capture_enable(true);
+    }
+    out->capture_on = s_vss.capture_on;
+    return ESP_OK;
+}
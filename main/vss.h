@@ -0,0 +1,84 @@
+/**
+ * Vehicle Speed Sensor
+ *
+ * Road speed from a Hall VSS without an interrupt per pulse at speed. Two
+ * peripherals watch the same pin:
+ *
+ *   PCNT      counts every edge in hardware. The count is never cleared;
+ *             speed comes from count differences over a sliding window,
+ *             so a read can't race a reset and lose pulses. The driver
+ *             accumulates overflows (one interrupt per 32767 pulses).
+ *   capture   MCPWM capture timestamps edges, so one pulse period gives
+ *             the speed where counting over a window is too coarse. It
+ *             interrupts once per edge, so it only runs at low pulse
+ *             rates and is switched off above VSS_CAPTURE_OFF_HZ.
+ *
+ * Between VSS_BLEND_LOW_HZ and VSS_BLEND_HIGH_HZ the two estimates are
+ * blended linearly. Below it, the period decides; if the next edge is
+ * overdue, speed falls as 1/(time since the last edge) and reaches 0 after
+ * VSS_STOP_MS, so a stop shows as a stop.
+ *
+ * Interrupts land on the core that calls vss_start().
+ */
+
+#ifndef VSS_H
+#define VSS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Pulse rate range where period timing hands over to counting */
+#define VSS_BLEND_LOW_HZ        40.0f
+#define VSS_BLEND_HIGH_HZ       80.0f
+/** Capture interrupts stop above OFF and resume below ON */
+#define VSS_CAPTURE_OFF_HZ      100.0f
+#define VSS_CAPTURE_ON_HZ       VSS_BLEND_HIGH_HZ
+/** No edge for this long: stopped */
+#define VSS_STOP_MS             1500
+
+/**
+ * @brief VSS configuration
+ */
+typedef struct {
+    gpio_num_t gpio;            /*!< Sensor output (pulled up) */
+    float pulses_per_mile;      /*!< Calibration */
+} vss_config_t;
+
+/**
+ * @brief Speed estimate and what it came from
+ */
+typedef struct {
+    float mph;                  /*!< Blended speed */
+    float count_hz;             /*!< Pulse rate from the counter window */
+    float period_hz;            /*!< Pulse rate from the last captured period, 0 if none */
+    float blend;                /*!< Weight of the count: 0 = period only, 1 = count only */
+    bool capture_on;            /*!< Capture interrupts running */
+    bool moving;                /*!< A pulse was seen within VSS_STOP_MS */
+    int32_t pulses;             /*!< Pulses counted since start */
+    uint32_t captures;          /*!< Edges timed by the capture unit */
+} vss_reading_t;
+
+/**
+ * @brief Set up the counter and capture unit and start counting
+ */
+esp_err_t vss_start(const vss_config_t *config);
+
+/**
+ * @brief Compute the current speed (task context, one task)
+ *
+ * Call every few milliseconds; the counter window advances at most every
+ * 100 ms, the period estimate on every call.
+ */
+esp_err_t vss_read(vss_reading_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VSS_H */
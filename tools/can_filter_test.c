@@ -0,0 +1,195 @@
+/**
+ * Host test of the TWAI acceptance filter synthesis
+ *
+ * Runs can_filter_synthesize() over the Holley catalog and over random ID
+ * sets, mostly clustered the way ECU IDs are (a few free low bits around
+ * one or two bases), some scattered. For every set it asserts that:
+ *
+ *   - every subscribed ID is accepted (can_filter_accepts(), which
+ *     evaluates the register encoding as the hardware does)
+ *   - false_positives == pass_count - n
+ *   - when the pass set is small enough to list, every ID from
+ *     can_filter_false_positives() is accepted, unsubscribed and listed
+ *     once, the list is exactly false_positives long, and a random ID
+ *     the filter accepts is either subscribed or on the list
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Imain tools/can_filter_test.c main/can_filter.c main/holley_can.c \
+ *      main/gauge_data.c -o can_filter_test
+ *   ./can_filter_test [random sets, default 200000]
+ *
+ * Exits non-zero on the first failure.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "can_filter.h"
+#include "holley_can.h"
+
+#define MAX_IDS         64
+#define LIST_MAX        4096        // Enumerate false positives up to this many
+#define PROBES          64          // Random IDs checked against the list per set
+
+static uint32_t s_fp[LIST_MAX];
+
+static uint32_t xorshift(uint32_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static bool contains(const uint32_t *sorted, size_t n, uint32_t id)
+{
+    return bsearch(&id, sorted, n, sizeof(uint32_t), cmp_u32) != NULL;
+}
+
+static void dump(const char *what, const uint32_t *ids, size_t n, const can_filter_t *f)
+{
+    fprintf(stderr, "FAIL: %s\n  %s, code %08" PRIx32 " mask %08" PRIx32 ", pass %" PRIu64
+            ", false positives %" PRIu64 "\n  ids:", what, f->dual ? "dual" : "single",
+            f->acceptance_code, f->acceptance_mask, f->pass_count, f->false_positives);
+    for (size_t i = 0; i < n; i++) {
+        fprintf(stderr, " %08" PRIx32, ids[i]);
+    }
+    fprintf(stderr, "\n");
+}
+
+// ids sorted and unique
+static int check_set(const uint32_t *ids, size_t n, uint32_t *rng)
+{
+    can_filter_t f;
+    if (!can_filter_synthesize(ids, n, &f)) {
+        dump("synthesis refused a non-empty set", ids, n, &f);
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (!can_filter_accepts(&f, ids[i])) {
+            dump("subscribed ID filtered out", ids, n, &f);
+            fprintf(stderr, "  rejected %08" PRIx32 "\n", ids[i]);
+            return 1;
+        }
+    }
+    if (f.pass_count < n || f.false_positives != f.pass_count - n) {
+        dump("false_positives != pass_count - n", ids, n, &f);
+        return 1;
+    }
+    if (f.false_positives > LIST_MAX) {
+        return 0;
+    }
+
+    size_t listed = can_filter_false_positives(&f, ids, n, s_fp, LIST_MAX);
+    if (listed != f.false_positives) {
+        dump("false positive list length differs from the count", ids, n, &f);
+        fprintf(stderr, "  listed %zu\n", listed);
+        return 1;
+    }
+    for (size_t i = 0; i < listed; i++) {
+        if (!can_filter_accepts(&f, s_fp[i]) || contains(ids, n, s_fp[i])) {
+            dump("listed false positive is rejected or subscribed", ids, n, &f);
+            fprintf(stderr, "  listed %08" PRIx32 "\n", s_fp[i]);
+            return 1;
+        }
+    }
+    qsort(s_fp, listed, sizeof(uint32_t), cmp_u32);
+    for (size_t i = 1; i < listed; i++) {
+        if (s_fp[i] == s_fp[i - 1]) {
+            dump("false positive listed twice", ids, n, &f);
+            return 1;
+        }
+    }
+
+    // Accepted IDs near the set (one or two bits off a subscribed ID) must
+    // all be accounted for
+    for (int p = 0; p < PROBES; p++) {
+        uint32_t id = ids[xorshift(rng) % n] ^ (1u << (xorshift(rng) % 29));
+        if (p & 1) {
+            id ^= 1u << (xorshift(rng) % 29);
+        }
+        if (can_filter_accepts(&f, id) && !contains(ids, n, id) && !contains(s_fp, listed, id)) {
+            dump("accepted ID neither subscribed nor listed", ids, n, &f);
+            fprintf(stderr, "  probe %08" PRIx32 "\n", id);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Random set: one or two clusters of IDs differing in a few random bits,
+// or IDs scattered over the whole space
+static size_t random_set(uint32_t *ids, uint32_t *rng)
+{
+    size_t want = 1 + xorshift(rng) % MAX_IDS;
+    int kind = xorshift(rng) % 8;
+    uint32_t base[2] = { xorshift(rng) & CAN_EXT_ID_MASK, xorshift(rng) & CAN_EXT_ID_MASK };
+    uint32_t spread[2] = { 0, 0 };
+    for (int c = 0; c < 2; c++) {
+        int bits = xorshift(rng) % 10;
+        for (int b = 0; b < bits; b++) {
+            // Mostly low bits, as with one ECU's block of IDs
+            spread[c] |= 1u << (xorshift(rng) % (b < bits / 2 ? 8 : 29));
+        }
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < want; i++) {
+        uint32_t id;
+        if (kind == 0) {
+            id = xorshift(rng) & CAN_EXT_ID_MASK;
+        } else {
+            int c = (kind >= 5) ? (int)(xorshift(rng) & 1) : 0;
+            id = (base[c] ^ (xorshift(rng) & spread[c])) & CAN_EXT_ID_MASK;
+        }
+        ids[n++] = id;
+    }
+    qsort(ids, n, sizeof(uint32_t), cmp_u32);
+    size_t u = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (u == 0 || ids[i] != ids[u - 1]) {
+            ids[u++] = ids[i];
+        }
+    }
+    return u;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t sets = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : 200000;
+    uint32_t rng = 0x2468ace1;
+
+    const uint32_t *catalog;
+    size_t num_catalog = holley_can_frame_ids(&catalog);
+    if (check_set(catalog, num_catalog, &rng)) {
+        return 1;
+    }
+    can_filter_t f;
+    can_filter_synthesize(catalog, num_catalog, &f);
+    printf("catalog: %zu IDs, %s filter, %" PRIu64 " false positives\n", num_catalog,
+           f.dual ? "dual" : "single", f.false_positives);
+
+    uint32_t ids[MAX_IDS];
+    uint32_t dual = 0;
+    uint32_t listed = 0;
+    for (uint32_t s = 0; s < sets; s++) {
+        size_t n = random_set(ids, &rng);
+        if (check_set(ids, n, &rng)) {
+            return 1;
+        }
+        can_filter_synthesize(ids, n, &f);
+        dual += f.dual;
+        listed += f.false_positives <= LIST_MAX;
+    }
+    printf("%" PRIu32 " random sets pass (%" PRIu32 " dual, %" PRIu32
+           " with false positives enumerated)\n", sets, dual, listed);
+    return 0;
+}
@@ -0,0 +1,273 @@
+/**
+ * Host replay of a CAN capture through the gauge pipeline
+ *
+ * Feeds a capture (main/can_capture.h) through what the ingestion task
+ * does with received frames: every period, decode the frames that arrived
+ * into gauge_data_t with holley_can_parse(), expire silent signals,
+ * publish through the seqlock snapshot if anything changed, and take the
+ * snapshot's changed bits back as the renderer does. The capture is mapped, not loaded, so multi-hour logs
+ * stream from the page cache.
+ *
+ * At the end it prints throughput and a fingerprint of every published
+ * value: the same capture and the same decoder give the same fingerprint,
+ * so a changed fingerprint after a decoder or catalog change is a
+ * behaviour change.
+ *
+ * Build from the repository root:
+ *   cc -O2 -Imain tools/can_replay.c main/can_capture.c main/holley_can.c \
+ *      main/gauge_data.c -o can_replay
+ *
+ * Get a capture from the truck (CAN_CAPTURE_BYTES in main.c) out of the
+ * monitor log:
+ *   grep -a '^CAP ' monitor.log | cut -c5- | xxd -r -p > drive.hcap
+ *
+ * Run:
+ *   ./can_replay [-s speed] [-p period_ms] [-r repeat] [-v] drive.hcap
+ *     -s 0   as fast as possible (default); 1 real time; N N times real time
+ *     -p 10  ingestion period in capture time (INGEST_PERIOD_MS)
+ *     -r 1   replay the capture this many times back to back
+ *     -v     print the gauges once per second of capture time, and the
+ *            signal rates at the end
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "can_capture.h"
+#include "gauge_data.h"
+#include "holley_can.h"
+
+#define FNV_OFFSET      0xcbf29ce484222325ULL
+#define FNV_PRIME       0x100000001b3ULL
+
+typedef struct {
+    double speed;               // 0 = unpaced
+    uint32_t period_us;
+    uint32_t repeat;
+    int verbose;
+} options_t;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t decoded;
+    uint64_t capture_us;        // Capture time covered (first to last frame)
+    uint64_t publishes;         // Publishes: renderer wakeups
+    uint64_t updates;           // Signals the renderer was told changed
+    uint64_t stale;             // Signals going stale
+    uint64_t fingerprint;       // Of the first pass
+    uint32_t passes;
+    double busy_s;              // Pipeline time, pacing sleeps excluded
+} result_t;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void sleep_until(double t)
+{
+    struct timespec ts = { .tv_sec = (time_t)t, .tv_nsec = (long)((t - (time_t)t) * 1e9) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+static uint64_t fnv1a(uint64_t h, const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * FNV_PRIME;
+    }
+    return h;
+}
+
+static void print_gauges(int64_t t_us, const gauge_data_t *g)
+{
+    printf("%8.2f s  RPM %5.0f | Coolant %3.0fF | Battery %4.1fV | Speed %3.0f MPH | "
+           "MAP %5.1f kPa | AFR %4.1f%s%s%s", t_us / 1e6, g->rpm, g->coolant_temp,
+           g->battery_voltage, g->speed, g->map, g->afr,
+           g->low_oil_pressure ? " OIL" : "", g->low_battery ? " BATT" : "",
+           g->high_coolant_temp ? " HOT" : "");
+    for (int i = 0; i < GAUGE_NUM_SIGNALS; i++) {
+        if (g->interval_ms[i] > 0 && !(g->fresh & GAUGE_BIT(i))) {
+            printf(" | %s stale", gauge_signal_name(i));
+        }
+    }
+    printf("\n");
+}
+
+// One pass over the capture; returns the byte offset decoding stopped at
+static size_t replay(const uint8_t *data, size_t size, const can_capture_header_t *hdr,
+                     const options_t *opt, result_t *res)
+{
+    static gauge_snapshot_t snap;
+    gauge_data_t g = {0}, shown;
+    int64_t prev_us = hdr->start_us;
+    size_t off = CAN_CAPTURE_HEADER_SIZE;
+    can_frame_t frame;
+    size_t n = can_capture_decode(data + off, size - off, &prev_us, &frame);
+    if (!n) {
+        return off;
+    }
+
+    // Periods are aligned to the first frame, as if the loop started then
+    int64_t t0 = frame.rx_us;
+    int64_t period_end = t0 + opt->period_us;
+    int64_t next_print = t0;
+    double wall0 = now_s();
+    double busy0 = wall0;
+
+    while (n) {
+        int64_t last_us = frame.rx_us;
+        while (n && frame.rx_us < period_end) {
+            res->decoded += holley_can_parse(&frame, &g, (uint32_t)(frame.rx_us / 1000));
+            res->frames++;
+            last_us = frame.rx_us;
+            off += n;
+            n = can_capture_decode(data + off, size - off, &prev_us, &frame);
+        }
+        if (opt->speed > 0) {
+            // The loop runs at the end of the period, in scaled capture time
+            res->busy_s += now_s() - busy0;
+            sleep_until(wall0 + (period_end - t0) / 1e6 / opt->speed);
+            busy0 = now_s();
+        }
+
+        res->stale += __builtin_popcount(gauge_data_expire(&g, (uint32_t)(period_end / 1000)));
+        if (g.changed) {
+            g.publish_us = period_end;
+            gauge_snapshot_publish(&snap, &g);
+            g.changed = 0;
+            res->publishes++;
+            if (res->passes == 0) {
+                res->fingerprint = fnv1a(res->fingerprint, &g, offsetof(gauge_data_t, publish_us));
+            }
+            res->updates += __builtin_popcount(gauge_snapshot_take(&snap, &shown));
+            if (opt->verbose && period_end >= next_print) {
+                print_gauges(period_end - t0, &shown);
+                next_print = period_end + 1000000;
+            }
+        }
+        // Skip idle periods up to the next frame or the next signal going
+        // stale, whichever is first; nothing changes in between
+        period_end += opt->period_us;
+        if (n && frame.rx_us >= period_end) {
+            int64_t next = frame.rx_us;
+            for (uint32_t m = g.fresh; m; m &= m - 1) {
+                int i = __builtin_ctz(m);
+                float limit = g.interval_ms[i] * GAUGE_STALE_INTERVALS;
+                int64_t expiry = (int64_t)(g.rx_ms[i] +
+                                           (limit > GAUGE_STALE_MIN_MS ? limit : GAUGE_STALE_MIN_MS)) * 1000;
+                if (expiry < next) {
+                    next = expiry;
+                }
+            }
+            if (next >= period_end) {
+                period_end += ((next - period_end) / opt->period_us + 1) * opt->period_us;
+            }
+        }
+        if (!n) {
+            res->capture_us += (uint64_t)(last_us - t0);
+        }
+    }
+    res->busy_s += now_s() - busy0;
+    if (opt->verbose && res->passes == 0) {
+        for (int i = 0; i < GAUGE_NUM_SIGNALS; i++) {
+            if (g.rx_ms[i]) {
+                printf("  %-16s %6.1f Hz%s\n", gauge_signal_name(i), gauge_data_rate_hz(&g, i),
+                       (g.fresh & GAUGE_BIT(i)) ? "" : ", stale");
+            }
+        }
+    }
+    res->passes++;
+    return off;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-s speed] [-p period_ms] [-r repeat] [-v] capture.hcap\n", prog);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    options_t opt = { .speed = 0, .period_us = 10000, .repeat = 1 };
+    int c;
+    while ((c = getopt(argc, argv, "s:p:r:v")) != -1) {
+        switch (c) {
+        case 's': opt.speed = strtod(optarg, NULL); break;
+        case 'p': opt.period_us = (uint32_t)(strtod(optarg, NULL) * 1000); break;
+        case 'r': opt.repeat = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'v': opt.verbose = 1; break;
+        default:  usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1 || opt.period_us == 0 || opt.repeat == 0 || opt.speed < 0) {
+        usage(argv[0]);
+    }
+
+    const char *path = argv[optind];
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(path);
+        return 1;
+    }
+    size_t size = (size_t)st.st_size;
+    const uint8_t *data = size ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : NULL;
+    if (data == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    close(fd);
+    can_capture_header_t hdr;
+    if (!data || !can_capture_read_header(data, size, &hdr)) {
+        fprintf(stderr, "%s: not a version %d CAN capture\n", path, CAN_CAPTURE_VERSION);
+        return 1;
+    }
+    madvise((void *)data, size, MADV_SEQUENTIAL);
+
+    printf("%s: %zu bytes, %" PRIu32 " bit/s", path, size, hdr.bitrate);
+    if (hdr.start_unix_us) {
+        time_t t = (time_t)(hdr.start_unix_us / 1000000);
+        char when[32];
+        strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S UTC", gmtime(&t));
+        printf(", recorded %s", when);
+    }
+    printf("\n");
+
+    result_t res = { .fingerprint = FNV_OFFSET };
+    size_t end = 0;
+    for (uint32_t r = 0; r < opt.repeat; r++) {
+        end = replay(data, size, &hdr, &opt, &res);
+    }
+    if (end != size) {
+        fprintf(stderr, "warning: stopped at byte %zu of %zu (truncated or malformed record)\n",
+                end, size);
+    }
+
+    printf("%" PRIu64 " frames (%" PRIu64 " decoded), %.1f s of capture at %u ms periods\n",
+           res.frames / opt.repeat, res.decoded / opt.repeat,
+           res.capture_us / opt.repeat / 1e6, (unsigned)(opt.period_us / 1000));
+    printf("%" PRIu64 " publishes (renderer wakeups), %" PRIu64 " signal updates, %" PRIu64
+           " went stale\n", res.publishes / opt.repeat, res.updates / opt.repeat,
+           res.stale / opt.repeat);
+    if (res.busy_s > 0) {
+        printf("%.3f s busy x%u: %.1f M frames/s, %.1f ns/frame, %.0fx real time\n", res.busy_s,
+               (unsigned)opt.repeat, res.frames / res.busy_s / 1e6, res.busy_s * 1e9 / res.frames,
+               res.capture_us / 1e6 / res.busy_s);
+    }
+    printf("fingerprint %016" PRIx64 "\n", res.fingerprint);
+    munmap((void *)data, size);
+    return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * Host test of the CAN frame ring
+ *
+ * First drives can_ring.c from one thread through fill, overflow, partial
+ * consumes and runs split at the end of the storage, with the counters
+ * started just below 2^32 so they wrap mid-test. Then runs a producer
+ * thread and a consumer thread on a small ring, the consumer stalling now
+ * and then so the ring overflows. Every frame carries a sequence number
+ * and a payload derived from it. The consumer checks that frames arrive
+ * in order and intact, and at the end that:
+ *
+ *   - frames received + overflows == frames pushed
+ *   - overflows equals the number of pushes that returned false
+ *   - the gaps in the received sequence add up to the overflows
+ *   - high_water never exceeds the capacity
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -pthread -Imain tools/can_ring_test.c main/can_ring.c -o can_ring_test
+ *   ./can_ring_test [frames, default 20000000]
+ *
+ * Exits non-zero on the first failure.
+ */
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "can_ring.h"
+
+#define CAPACITY        16
+// Counters start this far below the uint32_t wrap
+#define WRAP_START      (0u - 1000u)
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            fprintf(stderr, "FAIL line %d: ", __LINE__); \
+            fprintf(stderr, __VA_ARGS__); \
+            fprintf(stderr, "\n"); \
+            exit(1); \
+        } \
+    } while (0)
+
+static can_frame_t s_slots[CAPACITY];
+static can_ring_t s_ring;
+static uint32_t s_frames;
+static uint32_t s_rejected;
+
+static uint32_t xorshift(uint32_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static void make_frame(can_frame_t *f, uint32_t seq)
+{
+    memset(f, 0, sizeof(*f));
+    f->id = seq & CAN_EXT_ID_MASK;
+    f->extd = true;
+    f->dlc = 8;
+    for (int i = 0; i < 8; i++) {
+        f->data[i] = (uint8_t)((seq >> (i * 4)) ^ (i * 0x35));
+    }
+    f->rx_us = (int64_t)seq * 3;
+}
+
+// Sequence number of a frame, or -1 if its fields disagree (torn copy)
+static int64_t frame_seq(const can_frame_t *f)
+{
+    uint32_t seq = (uint32_t)(f->rx_us / 3);
+    can_frame_t want;
+    make_frame(&want, seq);
+    if (f->id != want.id || f->dlc != 8 || !f->extd || memcmp(f->data, want.data, 8) != 0) {
+        return -1;
+    }
+    return seq;
+}
+
+static void start_near_wrap(void)
+{
+    CHECK(can_ring_init(&s_ring, s_slots, CAPACITY), "init refused capacity %d", CAPACITY);
+    s_ring.head = WRAP_START;
+    s_ring.tail = WRAP_START;
+}
+
+static void single_thread(void)
+{
+    can_ring_t bad;
+    CHECK(!can_ring_init(&bad, s_slots, 0), "init accepted capacity 0");
+    CHECK(!can_ring_init(&bad, s_slots, 12), "init accepted capacity 12");
+
+    uint32_t rng = 0x9e3779b9;
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+    uint32_t dropped = 0;
+    can_frame_t f;
+    const can_frame_t *run;
+
+    start_near_wrap();
+    CHECK(can_ring_peek(&s_ring, &run) == 0, "new ring not empty");
+
+    // Fill to capacity, then one more is dropped
+    for (int i = 0; i < CAPACITY; i++) {
+        make_frame(&f, pushed++);
+        CHECK(can_ring_push(&s_ring, &f), "push %d of %d refused", i, CAPACITY);
+    }
+    make_frame(&f, pushed);
+    CHECK(!can_ring_push(&s_ring, &f), "push into a full ring accepted");
+    dropped++;
+    pushed++;
+    CHECK(s_ring.overflows == 1 && s_ring.high_water == CAPACITY,
+          "overflows %" PRIu32 " high_water %" PRIu32, s_ring.overflows, s_ring.high_water);
+    CHECK(can_ring_count(&s_ring) == CAPACITY, "count %" PRIu32, can_ring_count(&s_ring));
+
+    // Random pushes and partial consumes; runs must never cross the end of
+    // the storage, and the counters pass through the wrap
+    for (int step = 0; step < 200000; step++) {
+        int pushes = xorshift(&rng) % 6;
+        for (int i = 0; i < pushes; i++) {
+            uint32_t fill = pushed - dropped - popped;
+            make_frame(&f, pushed++);
+            bool ok = can_ring_push(&s_ring, &f);
+            CHECK(ok == (fill < CAPACITY), "push with %" PRIu32 " queued returned %d", fill, ok);
+            dropped += !ok;
+        }
+        uint32_t n = can_ring_peek(&s_ring, &run);
+        uint32_t queued = pushed - dropped - popped;
+        uint32_t to_end = CAPACITY - (uint32_t)(run - s_slots);
+        CHECK(n == (queued < to_end ? queued : to_end),
+              "peek returned %" PRIu32 " with %" PRIu32 " queued, %" PRIu32 " to the end",
+              n, queued, to_end);
+        CHECK(can_ring_count(&s_ring) == queued, "count %" PRIu32 ", want %" PRIu32,
+              can_ring_count(&s_ring), queued);
+        uint32_t take = n ? xorshift(&rng) % (n + 1) : 0;
+        for (uint32_t i = 0; i < take; i++) {
+            CHECK(frame_seq(&run[i]) >= 0, "torn frame");
+        }
+        can_ring_consume(&s_ring, take);
+        popped += take;
+    }
+    CHECK(s_ring.head - WRAP_START == pushed - dropped, "head did not advance by the pushes");
+    CHECK(s_ring.head < WRAP_START, "counters never wrapped");
+    CHECK(s_ring.overflows == dropped, "overflows %" PRIu32 ", %" PRIu32 " pushes refused",
+          s_ring.overflows, dropped);
+    printf("single thread: %" PRIu32 " pushed, %" PRIu32 " dropped, counters wrapped\n",
+           pushed, dropped);
+}
+
+static void *producer(void *arg)
+{
+    uint32_t rng = 0x6b43a9b5;
+    uint32_t burst = 0;
+    can_frame_t f;
+    for (uint32_t seq = 0; seq < s_frames; seq++) {
+        make_frame(&f, seq);
+        if (!can_ring_push(&s_ring, &f)) {
+            s_rejected++;
+        }
+        // Bursts of up to twice the capacity, so the ring both keeps up and
+        // overflows, on one core as well as on several
+        if (burst-- == 0) {
+            burst = xorshift(&rng) % (2 * CAPACITY);
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    uint32_t *received = arg;
+    uint32_t rng = 0x2545f491;
+    int64_t next = 0;
+    uint64_t gaps = 0;
+    const can_frame_t *run;
+
+    while (1) {
+        uint32_t n = can_ring_peek(&s_ring, &run);
+        if (n == 0) {
+            // The producer's last frame is either here or was dropped
+            int64_t last = next - 1;
+            if (last >= (int64_t)s_frames - 1 ||
+                (__atomic_load_n(&s_ring.head, __ATOMIC_ACQUIRE) - WRAP_START) +
+                __atomic_load_n(&s_ring.overflows, __ATOMIC_RELAXED) == s_frames) {
+                if (can_ring_peek(&s_ring, &run) == 0) {
+                    break;
+                }
+            }
+            sched_yield();
+            continue;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            int64_t seq = frame_seq(&run[i]);
+            CHECK(seq >= 0, "torn frame after %" PRId64, next - 1);
+            CHECK(seq >= next, "frame %" PRId64 " after %" PRId64 " (reordered or repeated)",
+                  seq, next - 1);
+            gaps += seq - next;
+            next = seq + 1;
+        }
+        can_ring_consume(&s_ring, n);
+        *received += n;
+        // Stall now and then so the producer overruns the ring
+        if ((xorshift(&rng) & 0xFF) == 0) {
+            for (int i = 0; i < 8; i++) {
+                sched_yield();
+            }
+        }
+    }
+    gaps += s_frames - next;
+    CHECK(gaps == s_ring.overflows, "sequence gaps %" PRIu64 ", overflows %" PRIu32,
+          gaps, s_ring.overflows);
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    s_frames = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : 20000000;
+
+    single_thread();
+
+    start_near_wrap();
+    uint32_t received = 0;
+    pthread_t prod, cons;
+    pthread_create(&cons, NULL, consumer, &received);
+    pthread_create(&prod, NULL, producer, NULL);
+    pthread_join(prod, NULL);
+    pthread_join(cons, NULL);
+
+    CHECK(received + s_ring.overflows == s_frames,
+          "received %" PRIu32 " + overflows %" PRIu32 " != pushed %" PRIu32,
+          received, s_ring.overflows, s_frames);
+    CHECK(s_ring.overflows == s_rejected, "overflows %" PRIu32 ", %" PRIu32 " pushes refused",
+          s_ring.overflows, s_rejected);
+    CHECK(s_ring.high_water <= CAPACITY, "high_water %" PRIu32, s_ring.high_water);
+    printf("two threads: %" PRIu32 " pushed, %" PRIu32 " received, %" PRIu32
+           " overflows, high water %" PRIu32 "/%d\n", s_frames, received, s_ring.overflows,
+           s_ring.high_water, CAPACITY);
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * Host check of signal freshness in gauge_data.c
+ *
+ * The ingestion task stamps each CAN signal with its frame's receive time,
+ * so a pass can decode a frame stamped after the time it expires against.
+ * This checks that such a signal stays fresh (no stale/live flap), that
+ * signals still go stale past their limit, exactly at it they do not, and
+ * that ages are right across the 2^32 ms wrap of the millisecond clock.
+ *
+ * Build and run from the repository root:
+ *   cc -Imain tools/gauge_data_test.c main/gauge_data.c -o gauge_data_test
+ *   ./gauge_data_test
+ *
+ * Exits non-zero on the first failure.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gauge_data.h"
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            fprintf(stderr, "FAIL line %d: ", __LINE__); \
+            fprintf(stderr, __VA_ARGS__); \
+            fprintf(stderr, "\n"); \
+            exit(1); \
+        } \
+    } while (0)
+
+// A signal received every interval_ms up to last_ms, with changed cleared
+static void received_every(gauge_data_t *g, gauge_signal_t s, uint32_t interval_ms,
+                           uint32_t last_ms)
+{
+    memset(g, 0, sizeof(*g));
+    for (int i = 8; i >= 0; i--) {
+        gauge_data_received(g, GAUGE_BIT(s), last_ms - i * interval_ms);
+    }
+    g->changed = 0;
+}
+
+int main(void)
+{
+    gauge_data_t g;
+    uint32_t stale;
+
+    // Frame stamped 1 ms after the pass's now
+    received_every(&g, GAUGE_RPM, 20, 1000);
+    gauge_data_received(&g, GAUGE_BIT(GAUGE_RPM), 2001);
+    stale = gauge_data_expire(&g, 2000);
+    CHECK(stale == 0 && (g.fresh & GAUGE_BIT(GAUGE_RPM)) && g.changed == 0,
+          "receive at 2001, expire at 2000: stale 0x%" PRIx32 " fresh 0x%" PRIx32
+          " changed 0x%" PRIx32, stale, g.fresh, g.changed);
+
+    // Much later stamps too: any negative age is fresh
+    stale = gauge_data_expire(&g, 2001 - 100000);
+    CHECK(stale == 0, "receive 100 s ahead went stale");
+
+    // 20 ms signal: limit is GAUGE_STALE_MIN_MS (4 x 20 ms is shorter)
+    received_every(&g, GAUGE_RPM, 20, 1000);
+    CHECK(gauge_data_expire(&g, 1000 + GAUGE_STALE_MIN_MS) == 0, "stale at the limit");
+    stale = gauge_data_expire(&g, 1000 + GAUGE_STALE_MIN_MS + 1);
+    CHECK(stale == GAUGE_BIT(GAUGE_RPM) && !(g.fresh & GAUGE_BIT(GAUGE_RPM)) &&
+          (g.changed & GAUGE_BIT(GAUGE_RPM)), "not stale 1 ms past the limit");
+    CHECK(gauge_data_expire(&g, 1000 + 10 * GAUGE_STALE_MIN_MS) == 0, "went stale twice");
+
+    // 200 ms signal: limit is GAUGE_STALE_INTERVALS mean intervals (the
+    // mean is still converging from its first gap)
+    received_every(&g, GAUGE_COOLANT_TEMP, 200, 5000);
+    uint32_t limit = (uint32_t)(g.interval_ms[GAUGE_COOLANT_TEMP] * GAUGE_STALE_INTERVALS);
+    CHECK(limit > GAUGE_STALE_MIN_MS, "mean interval %.1f ms", g.interval_ms[GAUGE_COOLANT_TEMP]);
+    CHECK(gauge_data_expire(&g, 5000 + limit) == 0, "stale at %" PRIu32 " ms", limit);
+    CHECK(gauge_data_expire(&g, 5000 + limit + 1) == GAUGE_BIT(GAUGE_COOLANT_TEMP),
+          "not stale past %" PRIu32 " ms", limit);
+
+    // Across the wrap of the millisecond clock
+    received_every(&g, GAUGE_RPM, 20, 0xFFFFFF80u);
+    CHECK(gauge_data_expire(&g, 0x00000010u) == 0, "stale 144 ms old, across the wrap");
+    CHECK(gauge_data_expire(&g, 0x00000100u) == GAUGE_BIT(GAUGE_RPM),
+          "fresh 384 ms old, across the wrap");
+
+    printf("freshness checks pass\n");
+    return 0;
+}
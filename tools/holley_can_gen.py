@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""
+Generate the Holley CAN lookup table and decode program from the signal
+catalog (main/holley_signals.def) as C source for main/holley_can.c.
+
+Lookup is a minimal-probe perfect hash (hash and displace): a frame ID
+picks a bucket with one multiplicative hash and a slot with another, XORed
+with the bucket's displacement. Every catalogued ID lands in its own slot,
+so a lookup is two multiplies, one table read and one compare regardless of
+catalog size. Each slot points at the frame's run of decode operations.
+
+Usage:
+  python tools/holley_can_gen.py [-i main/holley_signals.def] [-o main/holley_can_gen.h]
+  python tools/holley_can_gen.py --synthetic 500   # check hashing at scale, no output
+"""
+
+import argparse
+import random
+import re
+import sys
+
+ID_MASK = 0x1FFFFFFF
+EMPTY_ID = 0xFFFFFFFF
+WIDTHS = {1: "8", 2: "16", 4: "32"}
+MAX_TRIES = 10000
+
+SIGNAL_RE = re.compile(r"^\s*HOLLEY_SIGNAL\((.*)\)\s*$")
+WARN_RE = re.compile(r"^\s*HOLLEY_WARN\((.*)\)\s*$")
+
+
+def fail(path, lineno, msg):
+    sys.exit("%s:%d: %s" % (path, lineno, msg))
+
+
+def parse_catalog(path):
+    signals = []
+    warns = []
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            m = SIGNAL_RE.match(line)
+            if m:
+                args = [a.strip() for a in m.group(1).split(",")]
+                if len(args) != 7:
+                    fail(path, lineno, "HOLLEY_SIGNAL takes 7 arguments")
+                doc_id, byte, width, sign, scale, offset, field = args
+                byte, width = int(byte, 0), int(width, 0)
+                if width not in WIDTHS or byte + width > 8:
+                    fail(path, lineno, "bad byte/width %d/%d" % (byte, width))
+                if sign not in ("S", "U"):
+                    fail(path, lineno, "sign must be S or U")
+                signals.append({
+                    "id": int(doc_id, 0) & ID_MASK, "doc_id": doc_id, "byte": byte,
+                    "width": width, "sign": sign, "scale": scale, "offset": offset,
+                    "field": field,
+                })
+                continue
+            m = WARN_RE.match(line)
+            if m:
+                args = [a.strip() for a in m.group(1).split(",")]
+                if len(args) != 5:
+                    fail(path, lineno, "HOLLEY_WARN takes 5 arguments")
+                field, flag, op, threshold, gate = args
+                if op not in ("GT", "LT"):
+                    fail(path, lineno, "op must be GT or LT")
+                warns.append({"field": field, "flag": flag, "op": op,
+                              "threshold": threshold, "gate": gate})
+    if not signals:
+        sys.exit("%s: no signals" % path)
+    return signals, warns
+
+
+def bits_for(n):
+    bits = 1
+    while (1 << bits) < n:
+        bits += 1
+    return bits
+
+
+def hash_top(x, mult, bits):
+    return ((x * mult) & 0xFFFFFFFF) >> (32 - bits)
+
+
+def build_hash(ids, rng):
+    """Hash and displace over a power-of-two table at most ~80% full."""
+    slot_bits = bits_for(len(ids) * 5 // 4 + 1)
+    bucket_bits = max(1, slot_bits - 1)
+    nslots = 1 << slot_bits
+    for _ in range(MAX_TRIES):
+        m1 = rng.getrandbits(32) | 1
+        m2 = rng.getrandbits(32) | 1
+        buckets = [[] for _ in range(1 << bucket_bits)]
+        for i in ids:
+            buckets[hash_top(i, m1, bucket_bits)].append(i)
+        order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+        taken = [None] * nslots
+        disp = [0] * len(buckets)
+        ok = True
+        for b in order:
+            if not buckets[b]:
+                break
+            base = [hash_top(i, m2, slot_bits) for i in buckets[b]]
+            if len(set(base)) != len(base):
+                ok = False
+                break
+            for d in range(nslots):
+                slots = [s ^ d for s in base]
+                if all(taken[s] is None for s in slots):
+                    for s, i in zip(slots, buckets[b]):
+                        taken[s] = i
+                    disp[b] = d
+                    break
+            else:
+                ok = False
+                break
+        if ok:
+            return {"m1": m1, "m2": m2, "bucket_bits": bucket_bits,
+                    "slot_bits": slot_bits, "disp": disp, "slots": taken}
+    sys.exit("no perfect hash found for %d IDs" % len(ids))
+
+
+def lookup(h, i):
+    b = hash_top(i, h["m1"], h["bucket_bits"])
+    return hash_top(i, h["m2"], h["slot_bits"]) ^ h["disp"][b]
+
+
+def decode_program(signals, warns):
+    """Ops per frame ID, in catalog order: decodes, then their warnings."""
+    frames = {}
+    for s in signals:
+        frames.setdefault(s["id"], []).append(s)
+    program = []
+    runs = {}
+    for fid, sigs in frames.items():
+        first = len(program)
+        for s in sigs:
+            op = "HOLLEY_OP_%s%s" % (s["sign"], WIDTHS[s["width"]])
+            program.append("{ %s, %d, offsetof(gauge_data_t, %s), 0, 0, %s, %s },   // %s"
+                           % (op, s["byte"], s["field"], s["scale"], s["offset"], s["doc_id"]))
+        fields = {s["field"] for s in sigs}
+        for w in warns:
+            if w["field"] not in fields:
+                continue
+            gate = ("HOLLEY_GATE_NONE" if w["gate"] == "NONE"
+                    else "offsetof(gauge_data_t, %s)" % w["gate"])
+            program.append("{ HOLLEY_OP_WARN_%s, 0, offsetof(gauge_data_t, %s), "
+                           "offsetof(gauge_data_t, %s), %s, %s, 0 },"
+                           % (w["op"], w["field"], w["flag"], gate, w["threshold"]))
+        runs[fid] = (first, len(program) - first)
+    return program, runs
+
+
+def emit(path, src, signals, warns, ids, h, program, runs):
+    out = []
+    out.append("// Generated by tools/holley_can_gen.py from %s - do not edit" % src)
+    out.append("// %d signals in %d frames, %d warnings; %d-slot perfect hash"
+               % (len(signals), len(runs), len(warns), len(h["slots"])))
+    out.append("// Included by holley_can.c only")
+    out.append("")
+    out.append("#define HOLLEY_GEN_SIGNALS      %d" % len(signals))
+    out.append("#define HOLLEY_GEN_WARNS        %d" % len(warns))
+    out.append("#define HOLLEY_GEN_FRAMES       %d" % len(ids))
+    out.append("#define HOLLEY_GEN_ID_SUM       0x%XULL" % sum(s["id"] for s in signals))
+    out.append("#define HOLLEY_HASH_M1          0x%08Xu" % h["m1"])
+    out.append("#define HOLLEY_HASH_M2          0x%08Xu" % h["m2"])
+    out.append("#define HOLLEY_HASH_BUCKET_BITS %d" % h["bucket_bits"])
+    out.append("#define HOLLEY_HASH_SLOT_BITS   %d" % h["slot_bits"])
+    out.append("")
+    out.append("static const uint32_t s_frame_ids[%d] = {" % len(ids))
+    for i in range(0, len(ids), 6):
+        out.append("    " + " ".join("0x%08X," % fid for fid in ids[i:i + 6]))
+    out.append("};")
+    out.append("")
+    out.append("static const uint16_t s_disp[%d] = {" % len(h["disp"]))
+    for i in range(0, len(h["disp"]), 12):
+        out.append("    " + " ".join("%d," % d for d in h["disp"][i:i + 12]))
+    out.append("};")
+    out.append("")
+    out.append("static const holley_slot_t s_slots[%d] = {" % len(h["slots"]))
+    for fid in h["slots"]:
+        if fid is None:
+            out.append("    { 0x%08X, 0, 0 }," % EMPTY_ID)
+        else:
+            first, count = runs[fid]
+            out.append("    { 0x%08X, %d, %d }," % (fid, first, count))
+    out.append("};")
+    out.append("")
+    out.append("static const holley_op_t s_program[%d] = {" % len(program))
+    for op in program:
+        out.append("    " + op)
+    out.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("-i", "--input", default="main/holley_signals.def")
+    ap.add_argument("-o", "--output", default="main/holley_can_gen.h")
+    ap.add_argument("--synthetic", type=int, metavar="N",
+                    help="hash N random 29-bit IDs and report the table, write nothing")
+    ap.add_argument("--seed", type=int, default=1, help="hash search seed")
+    args = ap.parse_args()
+    rng = random.Random(args.seed)
+
+    if args.synthetic:
+        ids = rng.sample(range(ID_MASK + 1), args.synthetic)
+        h = build_hash(ids, rng)
+        assert all(h["slots"][lookup(h, i)] == i for i in ids)
+        print("%d IDs: %d slots, %d buckets, all unique" %
+              (len(ids), len(h["slots"]), len(h["disp"])))
+        return
+
+    signals, warns = parse_catalog(args.input)
+    fields = {s["field"] for s in signals}
+    for w in warns:
+        if w["field"] not in fields:
+            sys.exit("%s: warning on %s, which no signal decodes" % (args.input, w["field"]))
+    ids = sorted({s["id"] for s in signals})
+    h = build_hash(ids, rng)
+    program, runs = decode_program(signals, warns)
+    emit(args.output, args.input.split("/")[-1], signals, warns, ids, h, program, runs)
+    print("%s: %d signals, %d frames, %d slots, %d ops"
+          % (args.output, len(signals), len(ids), len(h["slots"]), len(program)))
+
+
+if __name__ == "__main__":
+    main()
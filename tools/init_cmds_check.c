@@ -0,0 +1,174 @@
+/**
+ * Host check of the packed ST77916 init stream against its .def source
+ *
+ * Parses st77916_init_cmds.def as text, independently of the X-macros in
+ * st77916_init_cmds.c, builds the stream the format describes
+ * (st77916_init_cmds.h) and compares it byte for byte with the compiled
+ * st77916_init_stream. It then walks the stream with
+ * st77916_init_cmd_next() and checks that it decodes to exactly
+ * ST77916_INIT_CMD_COUNT commands ending at the last byte. A change to
+ * the .def that the packer mishandles, or to the packer or decoder that
+ * no longer matches the format, fails here.
+ *
+ * Build and run from the repository root:
+ *   cc -Imain tools/init_cmds_check.c main/st77916_init_cmds.c -o init_cmds_check
+ *   ./init_cmds_check [main/st77916_init_cmds.def]
+ *
+ * Exits non-zero on a mismatch.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "st77916_init_cmds.h"
+
+#define MAX_STREAM      8192
+#define MAX_LINE        1024
+
+static uint8_t s_expect[MAX_STREAM];
+static size_t s_expect_len;
+
+static int fail(const char *path, int line, const char *what)
+{
+    fprintf(stderr, "%s:%d: %s\n", path, line, what);
+    return 1;
+}
+
+// Numbers of one entry's argument list, up to the closing parenthesis
+static int parse_args(const char *p, long *args, int max)
+{
+    int n = 0;
+    while (1) {
+        while (isspace((unsigned char)*p) || *p == ',') {
+            p++;
+        }
+        if (*p == ')') {
+            return n;
+        }
+        char *end;
+        long v = strtol(p, &end, 0);
+        if (end == p || n == max) {
+            return -1;
+        }
+        args[n++] = v;
+        p = end;
+    }
+}
+
+static void emit(uint8_t b)
+{
+    if (s_expect_len < MAX_STREAM) {
+        s_expect[s_expect_len] = b;
+    }
+    s_expect_len++;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "main/st77916_init_cmds.def";
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+
+    char line[MAX_LINE];
+    long args[ST77916_INIT_LEN_MASK + 2];
+    int lineno = 0;
+    int cmds = 0;
+    int in_comment = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *p = line;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (in_comment) {
+            in_comment = strstr(p, "*/") == NULL;
+            continue;
+        }
+        if (strncmp(p, "/*", 2) == 0) {
+            in_comment = strstr(p + 2, "*/") == NULL;
+            continue;
+        }
+        if (*p == '\0' || strncmp(p, "//", 2) == 0) {
+            continue;
+        }
+
+        int delayed;
+        if (strncmp(p, "ST77916_CMD_DELAY(", 18) == 0) {
+            delayed = 1;
+            p += 18;
+        } else if (strncmp(p, "ST77916_CMD(", 12) == 0) {
+            delayed = 0;
+            p += 12;
+        } else {
+            return fail(path, lineno, "not a command entry");
+        }
+        int n = parse_args(p, args, sizeof(args) / sizeof(args[0]));
+        if (n < 1 + delayed) {
+            return fail(path, lineno, "malformed argument list");
+        }
+        for (int i = 0; i < n; i++) {
+            if (args[i] < 0 || args[i] > 0xFF) {
+                return fail(path, lineno, "value out of byte range");
+            }
+        }
+        int len = n - 1 - delayed;
+        if (len > ST77916_INIT_LEN_MASK) {
+            return fail(path, lineno, "too many parameters");
+        }
+        if (delayed && args[1] == 0) {
+            return fail(path, lineno, "zero delay (use ST77916_CMD)");
+        }
+
+        emit((uint8_t)args[0]);
+        emit((uint8_t)(len | (delayed ? ST77916_INIT_DELAY_FLAG : 0)));
+        for (int i = 1; i < n; i++) {
+            emit((uint8_t)args[i]);
+        }
+        cmds++;
+    }
+    fclose(f);
+
+    if (s_expect_len > MAX_STREAM) {
+        fprintf(stderr, "expected stream larger than %d bytes\n", MAX_STREAM);
+        return 1;
+    }
+    if (cmds != ST77916_INIT_CMD_COUNT) {
+        fprintf(stderr, "%s has %d commands, ST77916_INIT_CMD_COUNT is %d\n", path, cmds,
+                ST77916_INIT_CMD_COUNT);
+        return 1;
+    }
+    if (s_expect_len != st77916_init_stream_size) {
+        fprintf(stderr, "expected %zu bytes, stream has %zu\n", s_expect_len,
+                st77916_init_stream_size);
+        return 1;
+    }
+    for (size_t i = 0; i < s_expect_len; i++) {
+        if (s_expect[i] != st77916_init_stream[i]) {
+            fprintf(stderr, "byte %zu: stream has 0x%02X, expected 0x%02X\n", i,
+                    st77916_init_stream[i], s_expect[i]);
+            return 1;
+        }
+    }
+
+    // The decoder walks the same commands and stops exactly at the end
+    int decoded = 0;
+    const uint8_t *pos = st77916_init_stream;
+    const uint8_t *last = pos;
+    st77916_init_cmd_t cmd;
+    while ((pos = st77916_init_cmd_next(pos, &cmd)) != NULL) {
+        decoded++;
+        last = pos;
+    }
+    if (decoded != cmds || last != st77916_init_stream + st77916_init_stream_size) {
+        fprintf(stderr, "decoder found %d commands ending at byte %td\n", decoded,
+                last - st77916_init_stream);
+        return 1;
+    }
+
+    printf("%d commands, %zu bytes: stream matches %s\n", cmds, s_expect_len, path);
+    return 0;
+}
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""
+Encode a boot splash image as RLE565 C source for the ST77916 panel driver.
+
+RLE565 packets (see st77916_rle565_t in main/st77916_pixel.h):
+  header & 0x80 -> run:     (header & 0x7F) + 1 copies of the next pixel
+  otherwise     -> literal: header + 1 pixels follow
+Pixels are little-endian RGB565.
+
+Input is a binary PPM (P6), which any image tool can export, e.g.
+  convert logo.png -resize 360x360 -background black -gravity center \
+          -extent 360x360 logo.ppm
+Without an input image a placeholder F100 badge is drawn.
+
+Usage:
+  python tools/splash_rle565.py [-i logo.ppm] [-o main/splash_f100.c]
+"""
+
+import argparse
+import sys
+
+WIDTH = 360
+HEIGHT = 360
+MAX_PACKET = 128
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def read_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        sys.exit("%s: expected 8-bit binary PPM (P6)" % path)
+    w, h = int(fields[1]), int(fields[2])
+    raster = data[pos + 1:pos + 1 + w * h * 3]
+    if len(raster) != w * h * 3:
+        sys.exit("%s: truncated image" % path)
+    pixels = [rgb565(raster[i], raster[i + 1], raster[i + 2])
+              for i in range(0, len(raster), 3)]
+    return w, h, pixels
+
+
+# 5x7 glyphs for the placeholder badge
+GLYPHS = {
+    "F": ["11111", "10000", "10000", "11110", "10000", "10000", "10000"],
+    "1": ["00100", "01100", "00100", "00100", "00100", "00100", "01110"],
+    "0": ["01110", "10001", "10011", "10101", "11001", "10001", "01110"],
+}
+
+
+def placeholder_badge():
+    """White-rimmed blue oval with "F100" on black, sized for the round glass."""
+    black = rgb565(0, 0, 0)
+    blue = rgb565(0x10, 0x34, 0x8C)
+    white = rgb565(0xFF, 0xFF, 0xFF)
+    cx, cy = WIDTH / 2, HEIGHT / 2
+    a, b, rim = 160.0, 80.0, 8.0
+
+    pixels = []
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            dx, dy = (x + 0.5 - cx), (y + 0.5 - cy)
+            outer = (dx / a) ** 2 + (dy / b) ** 2
+            inner = (dx / (a - rim)) ** 2 + (dy / (b - rim)) ** 2
+            if inner <= 1.0:
+                pixels.append(blue)
+            elif outer <= 1.0:
+                pixels.append(white)
+            else:
+                pixels.append(black)
+
+    text, scale, gap = "F100", 10, 10
+    text_w = len(text) * 5 * scale + (len(text) - 1) * gap
+    x0 = (WIDTH - text_w) // 2
+    y0 = (HEIGHT - 7 * scale) // 2
+    for i, ch in enumerate(text):
+        gx = x0 + i * (5 * scale + gap)
+        for row, bits in enumerate(GLYPHS[ch]):
+            for col, bit in enumerate(bits):
+                if bit != "1":
+                    continue
+                for y in range(y0 + row * scale, y0 + (row + 1) * scale):
+                    start = y * WIDTH + gx + col * scale
+                    pixels[start:start + scale] = [white] * scale
+    return WIDTH, HEIGHT, pixels
+
+
+def encode(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out += p.to_bytes(2, "little")
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while (i + run < len(pixels) and run < MAX_PACKET
+               and pixels[i + run] == pixels[i]):
+            run += 1
+        # A 2-pixel run costs 3 bytes either way; keep it in a literal
+        if run >= 3:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out += pixels[i].to_bytes(2, "little")
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def decode(data, count):
+    pixels = []
+    pos = 0
+    while pos < len(data) and len(pixels) < count:
+        h = data[pos]
+        pos += 1
+        n = (h & 0x7F) + 1
+        if h & 0x80:
+            pixels += [int.from_bytes(data[pos:pos + 2], "little")] * n
+            pos += 2
+        else:
+            for _ in range(n):
+                pixels.append(int.from_bytes(data[pos:pos + 2], "little"))
+                pos += 2
+    return pixels
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__,
+                                 formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("-i", "--input", help="binary PPM image (default: placeholder badge)")
+    ap.add_argument("-o", "--output", default="main/splash_f100.c")
+    ap.add_argument("-n", "--name", default="splash_f100")
+    args = ap.parse_args()
+
+    w, h, pixels = read_ppm(args.input) if args.input else placeholder_badge()
+    data = encode(pixels)
+    if decode(data, w * h) != pixels:
+        sys.exit("round trip failed")
+
+    source = args.input if args.input else "placeholder badge"
+    lines = [
+        "// Generated by tools/splash_rle565.py from %s - do not edit" % source,
+        "// %dx%d RGB565, %d bytes RLE565 (raw %d bytes)" % (w, h, len(data), w * h * 2),
+        "",
+        '#include "st77916_panel.h"',
+        "",
+        "static const uint8_t s_rle[] = {",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    lines += [
+        "};",
+        "",
+        "const st77916_splash_t %s = {" % args.name,
+        "    .w = %d," % w,
+        "    .h = %d," % h,
+        "    .rle = s_rle,",
+        "    .rle_len = sizeof(s_rle),",
+        "};",
+        "",
+    ]
+    with open(args.output, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+    print("%s: %dx%d, %d -> %d bytes" % (args.output, w, h, w * h * 2, len(data)))
+
+
+if __name__ == "__main__":
+    main()
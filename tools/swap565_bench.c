@@ -0,0 +1,166 @@
+/**
+ * Host equivalence test and benchmark for the RGB565 swap kernels
+ *
+ * Checks st77916_swap565_word() against st77916_swap565_generic() for
+ * every length up to MAX_CHECK_PIXELS, all four src/dst half-word
+ * alignments and in place at both alignments, with guard pixels around
+ * the destination to catch overruns. Then times both kernels on a
+ * display-buffer-sized run, the word kernel at every src/dst alignment
+ * (src and dst a half-word apart take the funnel-shift path).
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -Imain tools/swap565_bench.c main/st77916_pixel.c -o swap565_bench
+ *   ./swap565_bench [pixels per call, default 3600] [calls, default 20000]
+ *
+ * Exits non-zero on the first mismatch.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "st77916_pixel.h"
+
+#define MAX_CHECK_PIXELS    300
+#define GUARD_PIXELS        4
+#define GUARD               0xA5A5
+// Room for both alignments plus guards on each side
+#define CHECK_BUF_PIXELS    (MAX_CHECK_PIXELS + 2 * GUARD_PIXELS + 2)
+
+typedef void (*swap_fn_t)(uint16_t *dst, const uint16_t *src, size_t num_pixels);
+
+static uint32_t xorshift(uint32_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Word-aligned storage, so offsets 0 and 1 are the two half-word alignments
+typedef union {
+    uint32_t align;
+    uint16_t px[CHECK_BUF_PIXELS];
+} check_buf_t;
+
+static void fill_random(uint16_t *p, size_t n, uint32_t *rng)
+{
+    for (size_t i = 0; i < n; i++) {
+        p[i] = (uint16_t)xorshift(rng);
+    }
+}
+
+static void fill_guard(uint16_t *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        p[i] = GUARD;
+    }
+}
+
+// One case: run both kernels into separate buffers (or in place) and compare
+// the whole buffers, guards included
+static int check_case(size_t len, int src_off, int dst_off, int in_place, uint32_t *rng)
+{
+    static check_buf_t src, ref, out;
+    uint16_t *s = src.px + GUARD_PIXELS + src_off;
+    uint16_t *r = ref.px + GUARD_PIXELS + dst_off;
+    uint16_t *o = out.px + GUARD_PIXELS + dst_off;
+
+    fill_random(src.px, CHECK_BUF_PIXELS, rng);
+    if (in_place) {
+        memcpy(&ref, &src, sizeof(src));
+        memcpy(&out, &src, sizeof(src));
+        st77916_swap565_generic(r, r, len);
+        st77916_swap565_word(o, o, len);
+    } else {
+        fill_guard(ref.px, CHECK_BUF_PIXELS);
+        fill_guard(out.px, CHECK_BUF_PIXELS);
+        st77916_swap565_generic(r, s, len);
+        st77916_swap565_word(o, s, len);
+    }
+    if (memcmp(&ref, &out, sizeof(ref)) == 0) {
+        return 0;
+    }
+    for (size_t i = 0; i < CHECK_BUF_PIXELS; i++) {
+        if (ref.px[i] != out.px[i]) {
+            fprintf(stderr, "MISMATCH len %zu src+%d dst+%d%s: pixel %td is %04x, want %04x\n",
+                    len, src_off, dst_off, in_place ? " in place" : "",
+                    (ptrdiff_t)i - GUARD_PIXELS - dst_off, out.px[i], ref.px[i]);
+            break;
+        }
+    }
+    return 1;
+}
+
+static double time_kernel(swap_fn_t fn, uint16_t *dst, const uint16_t *src, size_t n,
+                          uint32_t calls)
+{
+    double t0 = now_s();
+    for (uint32_t i = 0; i < calls; i++) {
+        fn(dst, src, n);
+        // Keep the compiler from hoisting the call out of the loop
+        __asm__ volatile("" : : "r"(dst) : "memory");
+    }
+    return now_s() - t0;
+}
+
+int main(int argc, char **argv)
+{
+    size_t pixels = argc > 1 ? strtoul(argv[1], NULL, 0) : 3600;
+    uint32_t calls = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 20000;
+    uint32_t rng = 0x12345678;
+
+    uint32_t cases = 0;
+    for (size_t len = 0; len <= MAX_CHECK_PIXELS; len++) {
+        for (int src_off = 0; src_off < 2; src_off++) {
+            for (int dst_off = 0; dst_off < 2; dst_off++) {
+                if (check_case(len, src_off, dst_off, 0, &rng)) {
+                    return 1;
+                }
+                cases++;
+            }
+            if (check_case(len, src_off, src_off, 1, &rng)) {
+                return 1;
+            }
+            cases++;
+        }
+    }
+    printf("%" PRIu32 " cases match (lengths 0..%d, 4 alignments, in place)\n", cases,
+           MAX_CHECK_PIXELS);
+
+    if (pixels == 0 || calls == 0) {
+        return 0;
+    }
+    uint32_t *src_words = malloc((pixels + 1) * sizeof(uint16_t) + 4);
+    uint32_t *dst_words = malloc((pixels + 1) * sizeof(uint16_t) + 4);
+    if (!src_words || !dst_words) {
+        return 1;
+    }
+    uint16_t *src = (uint16_t *)src_words;
+    uint16_t *dst = (uint16_t *)dst_words;
+    fill_random(src, pixels + 1, &rng);
+
+    double mpx = (double)pixels * calls / 1e6;
+    double t_gen = time_kernel(st77916_swap565_generic, dst, src, pixels, calls);
+    double t_word = time_kernel(st77916_swap565_word, dst, src, pixels, calls);
+    double t_both = time_kernel(st77916_swap565_word, dst + 1, src + 1, pixels, calls);
+    double t_src = time_kernel(st77916_swap565_word, dst, src + 1, pixels, calls);
+    double t_dst = time_kernel(st77916_swap565_word, dst + 1, src, pixels, calls);
+    printf("%zu pixels x %" PRIu32 " calls\n", pixels, calls);
+    printf("  generic               %7.1f M px/s\n", mpx / t_gen);
+    printf("  word, aligned         %7.1f M px/s (%.2fx)\n", mpx / t_word, t_gen / t_word);
+    printf("  word, both +1         %7.1f M px/s (%.2fx)\n", mpx / t_both, t_gen / t_both);
+    printf("  word, src +1 (shift)  %7.1f M px/s (%.2fx)\n", mpx / t_src, t_gen / t_src);
+    printf("  word, dst +1 (shift)  %7.1f M px/s (%.2fx)\n", mpx / t_dst, t_gen / t_dst);
+    free(src_words);
+    free(dst_words);
+    return 0;
+}